@@ -205,6 +205,70 @@ namespace local
   std::vector<big_uint_type> b(a.size());
 }
 
+template<typename MultiplyFunctionType>
+float time_multiply(MultiplyFunctionType multiply)
+{
+  // Returns the average time in microseconds for one call of multiply().
+  std::size_t count = 0U;
+
+  float total_time = 0.0F;
+
+  const std::clock_t start = std::clock();
+
+  do
+  {
+    multiply();
+
+    ++count;
+  }
+  while((total_time = (float(std::clock() - start) / float(CLOCKS_PER_SEC))) < 2.0F);
+
+  return (total_time * 1.0E6F) / float(count);
+}
+
+void report_ntt_crossover(random_pcg32_fast& rng)
+{
+  // Compare the default cpp_int multiplication against the number theoretic
+  // transform at sizes either side of the crossover.  Below ntt_cutoff the
+  // default path is Toom-Cook, above it is the NTT, so the two columns
+  // should be roughly equal where the cutoff has been set.
+  using boost::multiprecision::cpp_int;
+  using boost::multiprecision::limb_type;
+
+  std::cout << "ntt_cutoff: " << boost::multiprecision::backends::ntt_cutoff << " limbs" << std::endl;
+
+  for(std::size_t limbs = 1000U; limbs <= 64000U; limbs *= 2U)
+  {
+    std::vector<limb_type> la(limbs);
+    std::vector<limb_type> lb(limbs);
+    std::vector<limb_type> lr(limbs * 2U);
+
+    for(auto i = 0U; i < limbs; ++i)
+    {
+      get_random_big_uint(rng, la.begin() + i);
+      get_random_big_uint(rng, lb.begin() + i);
+    }
+
+    cpp_int a;
+    cpp_int b;
+    cpp_int r;
+
+    import_bits(a, la.begin(), la.end(), std::numeric_limits<limb_type>::digits, false);
+    import_bits(b, lb.begin(), lb.end(), std::numeric_limits<limb_type>::digits, false);
+
+    const float t_default = time_multiply([&]() { r = a * b; });
+    const float t_ntt     = time_multiply([&]() { boost::multiprecision::backends::ntt_detail::multiply(lr.data(), la.data(), unsigned(limbs), lb.data(), unsigned(limbs)); });
+
+    std::cout << "limbs: "
+              << std::setw(6) << limbs
+              << ", cpp_int us: "
+              << std::setw(10) << t_default
+              << ", ntt us: "
+              << std::setw(10) << t_ntt
+              << std::endl;
+  }
+}
+
 int main()
 {
   random_pcg32_fast rng;
@@ -256,4 +320,14 @@ int main()
             << ", kops_per_sec: "
             << kops_per_sec
             << count << std::endl;
+
+  report_ntt_crossover(rng);
+
+  // Build with optimisation enabled, for example:
+  //   g++ -std=c++11 -O2 -I<boost-root> cpp_int_mul_timing.cpp
+  // Each row gives the average time for one product of two values of the
+  // given number of limbs, by the default cpp_int multiplication and by the
+  // NTT alone.  If the NTT is consistently faster well below ntt_cutoff (or
+  // slower well above it) on the target machine, rebuild with
+  // -DBOOST_MP_NTT_CUTOFF=<limbs> set near the size where the columns cross.
 }
@@ -0,0 +1,431 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Product trees, remainder trees and batch gcd, see D. J. Bernstein,
+// "How to find smooth parts of integers", and "Fast multiplication and its
+// applications", Algorithmic Number Theory, MSRI Publications 44 (2008).
+//
+// All the work at each level of a tree is independent, so each level with enough large
+// nodes is shared between threads.  The products themselves are formed with the usual multiplication
+// routines, which for cpp_int are subquadratic at the sizes found near the root.
+//
+#ifndef BOOST_MP_BATCH_GCD_HPP
+#define BOOST_MP_BATCH_GCD_HPP
+
+#include <boost/multiprecision/number.hpp>
+#include <boost/multiprecision/detail/parallel_tasks.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Size in bits of the nodes below which a level is formed by the calling thread alone,
+// as the work per node no longer repays starting threads; this is around the size at
+// which cpp_int switches to Karatsuba multiplication:
+//
+#ifdef BOOST_MP_BATCH_GCD_SERIAL_BITS
+static const unsigned batch_gcd_serial_bits = BOOST_MP_BATCH_GCD_SERIAL_BITS;
+#else
+static const unsigned batch_gcd_serial_bits = 2560;
+#endif
+
+//
+// The number of threads to use for a level with the given (positive) nodes, a single
+// thread unless there are at least two nodes per thread and some are large:
+//
+template <class Number>
+unsigned batch_level_threads(const std::vector<Number>& nodes, unsigned threads)
+{
+   unsigned chunks = parallel_thread_count(threads);
+   if ((chunks <= 1) || (nodes.size() < 2 * static_cast<std::size_t>(chunks)))
+      return 1;
+   for (std::size_t i = 0; i < nodes.size(); ++i)
+   {
+      if (msb(nodes[i]) >= batch_gcd_serial_bits)
+         return chunks;
+   }
+   return 1;
+}
+
+//
+// out[j] = in[2j] * in[2j+1], or in[2j] alone for the last element of an odd length level:
+//
+template <class Number>
+struct product_level_task
+{
+   const std::vector<Number>& in;
+   std::vector<Number>&       out;
+
+   product_level_task(const std::vector<Number>& i, std::vector<Number>& o) : in(i), out(o) {}
+
+   void operator()(std::size_t j)
+   {
+      if (2 * j + 1 < in.size())
+         out[j] = in[2 * j] * in[2 * j + 1];
+      else
+         out[j] = in[2 * j];
+   }
+};
+
+template <class Number>
+void product_level(const std::vector<Number>& in, std::vector<Number>& out, unsigned threads)
+{
+   out.resize((in.size() + 1) / 2);
+   product_level_task<Number> task(in, out);
+   parallel_for_tasks(out.size(), batch_level_threads(in, threads), task);
+}
+
+//
+// out[j] = parents[j / 2] mod nodes[j], or mod nodes[j]^2 when square is true:
+//
+template <class Number>
+struct remainder_level_task
+{
+   const std::vector<Number>& parents;
+   const std::vector<Number>& nodes;
+   std::vector<Number>&       out;
+   bool                       square;
+
+   remainder_level_task(const std::vector<Number>& p, const std::vector<Number>& n, std::vector<Number>& o, bool s)
+       : parents(p), nodes(n), out(o), square(s) {}
+
+   void operator()(std::size_t j)
+   {
+      if (square)
+      {
+         Number m = nodes[j] * nodes[j];
+         out[j]   = parents[j / 2] % m;
+      }
+      else
+         out[j] = parents[j / 2] % nodes[j];
+   }
+};
+
+template <class Number>
+void remainder_level(const std::vector<Number>& parents, const std::vector<Number>& nodes, std::vector<Number>& out, bool square, unsigned threads)
+{
+   out.resize(nodes.size());
+   remainder_level_task<Number> task(parents, nodes, out, square);
+   parallel_for_tasks(out.size(), batch_level_threads(nodes, threads), task);
+}
+
+//
+// out[j] = gcd(rems[j] / nodes[j], nodes[j]), where rems[j] = P mod nodes[j]^2 for P
+// the product of all the nodes:
+//
+template <class Number>
+struct batch_gcd_task
+{
+   const std::vector<Number>& rems;
+   const std::vector<Number>& nodes;
+   std::vector<Number>&       out;
+
+   batch_gcd_task(const std::vector<Number>& r, const std::vector<Number>& n, std::vector<Number>& o) : rems(r), nodes(n), out(o) {}
+
+   void operator()(std::size_t j)
+   {
+      Number q = rems[j] / nodes[j];
+      out[j]   = gcd(q, nodes[j]);
+   }
+};
+
+template <class Number>
+void batch_gcd_level(const std::vector<Number>& rems, const std::vector<Number>& nodes, std::vector<Number>& out, unsigned threads)
+{
+   out.resize(nodes.size());
+   batch_gcd_task<Number> task(rems, nodes, out);
+   parallel_for_tasks(out.size(), batch_level_threads(nodes, threads), task);
+}
+
+template <class Number>
+void check_batch_value(const Number& x)
+{
+   if (x <= 0)
+      BOOST_THROW_EXCEPTION(std::domain_error("Product trees require positive values."));
+}
+
+//
+// A level of a tree held on disk, one hexadecimal value per line, which is read and
+// written sequentially a block at a time:
+//
+inline std::string batch_file_name(const std::string& prefix, const char* kind, std::size_t level)
+{
+   return prefix + "." + kind + "." + boost::lexical_cast<std::string>(level);
+}
+
+template <class Number>
+class batch_file_writer
+{
+   std::ofstream m_stream;
+   std::size_t   m_count;
+
+ public:
+   explicit batch_file_writer(const std::string& name) : m_stream(name.c_str()), m_count(0)
+   {
+      if (!m_stream)
+         BOOST_THROW_EXCEPTION(std::runtime_error("Unable to open " + name + " for writing."));
+      m_stream.setf(std::ios_base::hex | std::ios_base::showbase);
+   }
+   void write(const std::vector<Number>& v)
+   {
+      for (std::size_t i = 0; i < v.size(); ++i)
+         m_stream << v[i] << '\n';
+      if (!m_stream)
+         BOOST_THROW_EXCEPTION(std::runtime_error("Error writing a product tree level."));
+      m_count += v.size();
+   }
+   std::size_t count() const { return m_count; }
+};
+
+//
+// Removes the files of the tree levels which are no longer needed, and on destruction any
+// that remain, so that nothing is left behind if an exception is thrown part way through:
+//
+class batch_file_remover
+{
+   std::vector<std::string> m_names;
+
+   batch_file_remover(const batch_file_remover&);
+   batch_file_remover& operator=(const batch_file_remover&);
+
+ public:
+   batch_file_remover() {}
+   ~batch_file_remover()
+   {
+      for (std::size_t i = 0; i < m_names.size(); ++i)
+         std::remove(m_names[i].c_str());
+   }
+   //
+   // Records a file about to be created, and returns its name:
+   //
+   const std::string& add(const std::string& prefix, const char* kind, std::size_t level)
+   {
+      m_names.push_back(batch_file_name(prefix, kind, level));
+      return m_names.back();
+   }
+   void remove(const std::string& prefix, const char* kind, std::size_t level)
+   {
+      std::string name = batch_file_name(prefix, kind, level);
+      std::remove(name.c_str());
+      m_names.erase(std::remove(m_names.begin(), m_names.end(), name), m_names.end());
+   }
+};
+
+template <class Number>
+class batch_file_reader
+{
+   std::ifstream m_stream;
+
+ public:
+   explicit batch_file_reader(const std::string& name) : m_stream(name.c_str())
+   {
+      if (!m_stream)
+         BOOST_THROW_EXCEPTION(std::runtime_error("Unable to open " + name + " for reading."));
+      m_stream.setf(std::ios_base::hex, std::ios_base::basefield);
+   }
+   //
+   // Reads up to n values into v, which is empty at the end of the file:
+   //
+   void read(std::vector<Number>& v, std::size_t n)
+   {
+      v.clear();
+      Number x;
+      while ((v.size() < n) && (m_stream >> x))
+         v.push_back(x);
+   }
+};
+
+} // namespace detail
+
+//
+// The levels of products of pairs of values, from the values themselves at level 0 up
+// to their product at the root:
+//
+template <class Number>
+class product_tree
+{
+   BOOST_STATIC_ASSERT_MSG(is_number<Number>::value && (number_category<Number>::value == number_kind_integer), "product_tree requires a multiprecision integer type.");
+
+   std::vector<std::vector<Number> > m_levels;
+
+ public:
+   product_tree() {}
+   //
+   // The values must all be positive, up to threads threads are used to form each level,
+   // or as many as the hardware supports when threads is zero:
+   //
+   template <class Iterator>
+   product_tree(Iterator first, Iterator last, unsigned threads = 0)
+   {
+      m_levels.push_back(std::vector<Number>(first, last));
+      for (std::size_t i = 0; i < m_levels[0].size(); ++i)
+         detail::check_batch_value(m_levels[0][i]);
+      while (m_levels.back().size() > 1)
+      {
+         m_levels.push_back(std::vector<Number>());
+         detail::product_level(m_levels[m_levels.size() - 2], m_levels.back(), threads);
+      }
+   }
+
+   std::size_t                size() const { return m_levels.empty() ? 0 : m_levels[0].size(); }
+   std::size_t                levels() const { return m_levels.size(); }
+   const std::vector<Number>& level(std::size_t i) const { return m_levels[i]; }
+   const std::vector<Number>& leaves() const { return m_levels[0]; }
+   const Number&              root() const { return m_levels.back()[0]; }
+};
+
+//
+// Returns value mod x for each value x at the leaves of the tree, reducing the remainder
+// at each node modulo its children on the way down.  The results are in [0, x):
+//
+template <class Number>
+std::vector<Number> remainder_tree(const Number& value, const product_tree<Number>& tree, unsigned threads = 0)
+{
+   std::vector<Number> rems, next;
+   if (!tree.size())
+      return rems;
+   Number r = value % tree.root();
+   if (r < 0)
+      r += tree.root();
+   rems.push_back(r);
+   for (std::size_t i = tree.levels() - 1; i > 0; --i)
+   {
+      detail::remainder_level(rems, tree.level(i - 1), next, false, threads);
+      rems.swap(next);
+   }
+   return rems;
+}
+
+//
+// Returns gcd(x_i, prod(x_j, j != i)) for each of the positive values x_i in [first, last),
+// by Bernstein's method: reduce the product of all the values modulo x_i^2 using a
+// remainder tree, when gcd((P mod x_i^2) / x_i, x_i) is the result:
+//
+template <class Number>
+std::vector<Number> batch_gcd(const product_tree<Number>& tree, unsigned threads = 0)
+{
+   std::vector<Number> rems, next;
+   if (!tree.size())
+      return rems;
+   rems.push_back(tree.root());
+   for (std::size_t i = tree.levels() - 1; i > 0; --i)
+   {
+      detail::remainder_level(rems, tree.level(i - 1), next, true, threads);
+      rems.swap(next);
+   }
+   detail::batch_gcd_level(rems, tree.leaves(), next, threads);
+   return next;
+}
+
+template <class Iterator>
+std::vector<typename std::iterator_traits<Iterator>::value_type> batch_gcd(Iterator first, Iterator last, unsigned threads = 0)
+{
+   typedef typename std::iterator_traits<Iterator>::value_type number_type;
+   return batch_gcd(product_tree<number_type>(first, last, threads), threads);
+}
+
+//
+// As above, but with the levels of the trees kept in files named by appending ".product.N"
+// and ".remainder.N" to prefix, rather than in memory.  Each level is processed block_size
+// values at a time, so that only a few blocks need be in memory at once however many values
+// there are, and the files are removed once they are no longer needed.  The values are read
+// only once, so Iterator may be an input iterator such as std::istream_iterator:
+//
+template <class Iterator>
+std::vector<typename std::iterator_traits<Iterator>::value_type> batch_gcd(Iterator first, Iterator last, const std::string& prefix, std::size_t block_size = 4096, unsigned threads = 0)
+{
+   typedef typename std::iterator_traits<Iterator>::value_type number_type;
+
+   std::vector<number_type>   in, out, parents, rems;
+   std::vector<number_type>   result;
+   detail::batch_file_remover files;
+   if (block_size < 2)
+      block_size = 2;
+   block_size += block_size & 1u; // even, so that siblings are never split between blocks
+   //
+   // Level 0 is the values themselves:
+   //
+   std::size_t count = 0;
+   {
+      detail::batch_file_writer<number_type> writer(files.add(prefix, "product", 0));
+      while (first != last)
+      {
+         in.clear();
+         for (; (first != last) && (in.size() < block_size); ++first)
+         {
+            in.push_back(*first);
+            detail::check_batch_value(in.back());
+         }
+         writer.write(in);
+      }
+      count = writer.count();
+   }
+   if (!count)
+      return result;
+   //
+   // Build the product tree upwards one level at a time:
+   //
+   std::size_t top = 0;
+   for (std::size_t level_size = count; level_size > 1; level_size = (level_size + 1) / 2, ++top)
+   {
+      detail::batch_file_reader<number_type> reader(detail::batch_file_name(prefix, "product", top));
+      detail::batch_file_writer<number_type> writer(files.add(prefix, "product", top + 1));
+      for (reader.read(in, block_size); in.size(); reader.read(in, block_size))
+      {
+         detail::product_level(in, out, threads);
+         writer.write(out);
+      }
+   }
+   //
+   // Then work down again, with the remainders for level i + 1 read in step with the
+   // nodes of level i, two children for each parent:
+   //
+   {
+      detail::batch_file_reader<number_type> reader(detail::batch_file_name(prefix, "product", top));
+      detail::batch_file_writer<number_type> writer(files.add(prefix, "remainder", top));
+      reader.read(in, 1);
+      writer.write(in);
+   }
+   files.remove(prefix, "product", top);
+   for (std::size_t i = top; i > 0; --i)
+   {
+      {
+         detail::batch_file_reader<number_type> parent_reader(detail::batch_file_name(prefix, "remainder", i));
+         detail::batch_file_reader<number_type> reader(detail::batch_file_name(prefix, "product", i - 1));
+         detail::batch_file_writer<number_type> writer(files.add(prefix, "remainder", i - 1));
+         for (reader.read(in, block_size); in.size(); reader.read(in, block_size))
+         {
+            parent_reader.read(parents, (in.size() + 1) / 2);
+            detail::remainder_level(parents, in, out, true, threads);
+            if (i == 1)
+            {
+               detail::batch_gcd_level(out, in, rems, threads);
+               result.insert(result.end(), rems.begin(), rems.end());
+            }
+            else
+               writer.write(out);
+         }
+      }
+      files.remove(prefix, "remainder", i);
+      if (i > 1)
+         files.remove(prefix, "product", i - 1);
+   }
+   if (top == 0)
+      result.push_back(number_type(1));
+   return result;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
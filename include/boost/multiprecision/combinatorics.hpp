@@ -0,0 +1,269 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Factorials, binomial coefficients, double factorials and primorials of
+// multiprecision integers.  Rather than multiplying in the factors one at a
+// time, which is quadratic in the size of the result, we find the exponent of
+// each prime in the result and form the product of prime powers as
+//
+//    prod(p^e) = prod over bits j of (product of the p whose e has bit j set)^(2^j)
+//
+// evaluated by squaring and multiplying from the highest bit down, see for
+// example P. Luschny, "Fast Factorial Functions".  Each of the products of
+// primes is a balanced product tree, so the large multiplications are between
+// values of similar size where the subquadratic algorithms apply, and the
+// subtrees may be shared out between threads.
+//
+#ifndef BOOST_MP_COMBINATORICS_HPP
+#define BOOST_MP_COMBINATORICS_HPP
+
+#include <boost/multiprecision/number.hpp>
+#include <boost/multiprecision/detail/parallel_tasks.hpp>
+#include <vector>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Number of words below which a product is formed by multiplying in one word at a time:
+//
+#ifdef BOOST_MP_PRODUCT_TREE_LEAF
+static const unsigned product_tree_leaf = BOOST_MP_PRODUCT_TREE_LEAF;
+#else
+static const unsigned product_tree_leaf = 16;
+#endif
+
+//
+// The primes up to n, by the sieve of Eratosthenes over the odd values:
+//
+inline void combinatorial_primes(unsigned n, std::vector<unsigned>& primes)
+{
+   primes.clear();
+   if (n < 2)
+      return;
+   primes.push_back(2);
+   std::vector<char> composite(n / 2 + 1);
+   for (unsigned i = 3; i <= n; i += 2)
+   {
+      if (composite[i / 2])
+         continue;
+      primes.push_back(i);
+      for (boost::uint64_t j = static_cast<boost::uint64_t>(i) * i; j <= n; j += 2 * i)
+         composite[static_cast<std::size_t>(j / 2)] = true;
+   }
+}
+//
+// Appends the value p to the packed factors, multiplying it into the last word while the
+// product fits:
+//
+inline void push_packed_factor(std::vector<boost::uint64_t>& words, boost::uint64_t p)
+{
+   if (!words.empty() && (words.back() <= ~static_cast<boost::uint64_t>(0u) / p))
+      words.back() *= p;
+   else
+      words.push_back(p);
+}
+//
+// Sets result to the product of words[first, last) by a balanced product tree:
+//
+template <class Integer>
+void word_product(Integer& result, const std::vector<boost::uint64_t>& words, std::size_t first, std::size_t last)
+{
+   if (last - first <= product_tree_leaf)
+   {
+      result = 1u;
+      for (; first < last; ++first)
+         result *= words[first];
+      return;
+   }
+   std::size_t mid = first + (last - first) / 2;
+   Integer     a, b;
+   word_product(a, words, first, mid);
+   word_product(b, words, mid, last);
+   result = a * b;
+}
+
+template <class Integer>
+struct word_product_task
+{
+   const std::vector<boost::uint64_t>& words;
+   std::vector<Integer>&               results;
+
+   word_product_task(const std::vector<boost::uint64_t>& w, std::vector<Integer>& r) : words(w), results(r) {}
+
+   void operator()(std::size_t i)
+   {
+      std::size_t n = results.size();
+      word_product(results[i], words, words.size() * i / n, words.size() * (i + 1) / n);
+   }
+};
+
+template <class Integer>
+struct pair_product_task
+{
+   std::vector<Integer>& values;
+   std::size_t           stride;
+
+   pair_product_task(std::vector<Integer>& v, std::size_t s) : values(v), stride(s) {}
+
+   void operator()(std::size_t i)
+   {
+      std::size_t j = 2 * i * stride;
+      if (j + stride < values.size())
+         values[j] *= values[j + stride];
+   }
+};
+//
+// Sets result to the product of words: with more than one thread the top of the product
+// tree is split into a chunk per thread, and then the chunks are combined in pairs, each
+// level of pairs in parallel:
+//
+template <class Integer>
+void parallel_word_product(Integer& result, const std::vector<boost::uint64_t>& words, unsigned threads)
+{
+   std::size_t chunks = parallel_thread_count(threads);
+   if ((chunks <= 1) || (words.size() < 2 * chunks * product_tree_leaf))
+   {
+      word_product(result, words, 0, words.size());
+      return;
+   }
+   std::vector<Integer>       partial(chunks);
+   word_product_task<Integer> task(words, partial);
+   parallel_for_tasks(chunks, threads, task);
+   for (std::size_t stride = 1; stride < chunks; stride *= 2)
+   {
+      pair_product_task<Integer> pairs(partial, stride);
+      parallel_for_tasks((chunks + 2 * stride - 1) / (2 * stride), threads, pairs);
+   }
+   result.swap(partial[0]);
+}
+//
+// Sets result to the product of primes[i]^exponents[i], the power of two (if any) is
+// applied as a shift at the end:
+//
+template <class Integer>
+void prime_power_product(Integer& result, const std::vector<unsigned>& primes, const std::vector<unsigned>& exponents, unsigned threads)
+{
+   unsigned shift = 0, max_exponent = 0;
+   for (std::size_t i = 0; i < primes.size(); ++i)
+   {
+      if (primes[i] == 2)
+         shift = exponents[i];
+      else if (exponents[i] > max_exponent)
+         max_exponent = exponents[i];
+   }
+   result = 1u;
+   std::vector<boost::uint64_t> words;
+   Integer                      t;
+   unsigned bits = 0;
+   while (max_exponent >> bits)
+      ++bits;
+   for (unsigned bit = bits; bit-- > 0;)
+   {
+      words.clear();
+      for (std::size_t i = 0; i < primes.size(); ++i)
+      {
+         if ((primes[i] != 2) && ((exponents[i] >> bit) & 1u))
+            push_packed_factor(words, primes[i]);
+      }
+      result *= result;
+      if (!words.empty())
+      {
+         parallel_word_product(t, words, threads);
+         result *= t;
+      }
+   }
+   result <<= shift;
+}
+//
+// The exponent of p in n!, by Legendre's formula:
+//
+inline unsigned factorial_exponent(unsigned n, unsigned p)
+{
+   unsigned e = 0;
+   while (n >= p)
+   {
+      n /= p;
+      e += n;
+   }
+   return e;
+}
+
+} // namespace detail
+
+//
+// Returns n!, n!! = n(n-2)(n-4)..., C(n, k) = n! / (k! (n-k)!) and the product of the primes
+// up to n.  Up to threads threads are used to form the products of primes, or as many as the
+// hardware supports when threads is zero:
+//
+template <class Integer>
+typename enable_if_c<number_category<Integer>::value == number_kind_integer, Integer>::type
+factorial(unsigned n, unsigned threads = 0)
+{
+   std::vector<unsigned> primes, exponents;
+   detail::combinatorial_primes(n, primes);
+   for (std::size_t i = 0; i < primes.size(); ++i)
+      exponents.push_back(detail::factorial_exponent(n, primes[i]));
+   Integer result;
+   detail::prime_power_product(result, primes, exponents, threads);
+   return result;
+}
+
+template <class Integer>
+typename enable_if_c<number_category<Integer>::value == number_kind_integer, Integer>::type
+double_factorial(unsigned n, unsigned threads = 0)
+{
+   //
+   // For even n, n!! = 2^(n/2) (n/2)!, and for odd n, n! = n!! (n-1)!! so that
+   // n!! = n! / (2^m m!) with m = (n-1)/2:
+   //
+   std::vector<unsigned> primes, exponents;
+   detail::combinatorial_primes(n, primes);
+   unsigned m = n / 2;
+   for (std::size_t i = 0; i < primes.size(); ++i)
+   {
+      if (n & 1u)
+         exponents.push_back(primes[i] == 2 ? 0 : detail::factorial_exponent(n, primes[i]) - detail::factorial_exponent(m, primes[i]));
+      else
+         exponents.push_back(detail::factorial_exponent(m, primes[i]) + (primes[i] == 2 ? m : 0));
+   }
+   Integer result;
+   detail::prime_power_product(result, primes, exponents, threads);
+   return result;
+}
+
+template <class Integer>
+typename enable_if_c<number_category<Integer>::value == number_kind_integer, Integer>::type
+binomial(unsigned n, unsigned k, unsigned threads = 0)
+{
+   if (k > n)
+      return Integer(0u);
+   std::vector<unsigned> primes, exponents;
+   detail::combinatorial_primes(n, primes);
+   for (std::size_t i = 0; i < primes.size(); ++i)
+      exponents.push_back(detail::factorial_exponent(n, primes[i]) - detail::factorial_exponent(k, primes[i]) - detail::factorial_exponent(n - k, primes[i]));
+   Integer result;
+   detail::prime_power_product(result, primes, exponents, threads);
+   return result;
+}
+
+template <class Integer>
+typename enable_if_c<number_category<Integer>::value == number_kind_integer, Integer>::type
+primorial(unsigned n, unsigned threads = 0)
+{
+   std::vector<unsigned>        primes;
+   std::vector<boost::uint64_t> words;
+   detail::combinatorial_primes(n, primes);
+   for (std::size_t i = 0; i < primes.size(); ++i)
+      detail::push_packed_factor(words, primes[i]);
+   Integer result;
+   detail::parallel_word_product(result, words, threads);
+   return result;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
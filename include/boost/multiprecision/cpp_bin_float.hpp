@@ -468,6 +468,10 @@ class cpp_bin_float
    }
 
    std::string str(std::streamsize dig, std::ios_base::fmtflags f) const;
+   //
+   // As str(), but writes to [first, last), returns a null pointer if there is not enough room:
+   //
+   char* to_chars(char* first, char* last, std::streamsize dig, std::ios_base::fmtflags f) const;
 
    void negate()
    {
@@ -470,7 +470,7 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
 }
 
 template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
-std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::str(std::streamsize dig, std::ios_base::fmtflags f) const
+char* cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::to_chars(char* first, char* last, std::streamsize dig, std::ios_base::fmtflags f) const
 {
    if (dig == 0)
       dig = std::numeric_limits<number<cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> > >::max_digits10;
@@ -478,8 +478,6 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
    bool scientific = (f & std::ios_base::scientific) == std::ios_base::scientific;
    bool fixed      = !scientific && (f & std::ios_base::fixed);
 
-   std::string s;
-
    if (exponent() <= cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::max_exponent)
    {
       // How far to left-shift in order to demormalise the mantissa:
@@ -498,11 +496,7 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
       if (digits_wanted < -1)
       {
          // Fixed precision, no significant digits, and nothing to round!
-         s = "0";
-         if (sign())
-            s.insert(static_cast<std::string::size_type>(0), 1, '-');
-         boost::multiprecision::detail::format_float_string(s, base10_exp, dig, f, true);
-         return s;
+         return boost::multiprecision::detail::format_float_chars(first, last, "0", 1, sign(), base10_exp, dig, f, true);
       }
       //
       // power10 is the base10 exponent we need to multiply/divide by in order
@@ -516,6 +510,10 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
       shift -= power10;
       cpp_int               i;
       int                   roundup   = 0; // 0=no rounding, 1=tie, 2=up
+      char                  local[128];
+      std::vector<char>     storage;
+      char*                 digits = local;
+      std::size_t           n      = 0;
       static const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
       //
       // Set our working precision - this is heuristic based, we want
@@ -631,13 +629,24 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
                roundup = c < 0 ? 0 : c == 0 ? 1 : 2;
             }
          }
-         s = i.str(0, std::ios_base::fmtflags(0));
+         //
+         // Write out the digits of i, in a local buffer if it's large enough:
+         //
+         std::size_t room = i ? static_cast<std::size_t>(msb(i) * 30103uLL / 100000u) + 2 : 1;
+         if (room > sizeof(local))
+         {
+            storage.resize(room);
+            digits = &storage[0];
+         }
+         else
+            digits = local;
+         n = write_decimal_chars(digits, digits + room, i.backend()) - digits;
          //
          // Check if we got the right number of digits, this
          // is really a test of whether we calculated the
          // decimal exponent correctly:
          //
-         boost::intmax_t digits_got = i ? static_cast<boost::intmax_t>(s.size()) : 0;
+         boost::intmax_t digits_got = i ? static_cast<boost::intmax_t>(n) : 0;
          if (digits_got != digits_wanted)
          {
             base10_exp += digits_got - digits_wanted;
@@ -658,34 +667,53 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
       // the conversion to a string and the digit count check, we might as well
       // do it here:
       //
-      if ((roundup == 2) || ((roundup == 1) && ((s[s.size() - 1] - '0') & 1)))
+      if ((roundup == 2) || ((roundup == 1) && ((digits[n - 1] - '0') & 1)))
       {
-         boost::multiprecision::detail::round_string_up_at(s, static_cast<int>(s.size() - 1), base10_exp);
+         boost::multiprecision::detail::round_chars_up_at(digits, n, static_cast<int>(n - 1), base10_exp);
       }
+      return boost::multiprecision::detail::format_float_chars(first, last, digits, n, sign(), base10_exp, dig, f, false);
+   }
+   if (exponent() == exponent_zero)
+      return boost::multiprecision::detail::format_float_chars(first, last, "0", 1, sign(), 0, dig, f, true);
+   const char* special = exponent() == exponent_nan ? "nan" : sign() ? "-inf" : f & std::ios_base::showpos ? "+inf" : "inf";
+   std::size_t size    = std::strlen(special);
+   if (size > static_cast<std::size_t>(last - first))
+      return 0;
+   std::memcpy(first, special, size);
+   return first + size;
+}
 
-      if (sign())
-         s.insert(static_cast<std::string::size_type>(0), 1, '-');
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::str(std::streamsize dig, std::ios_base::fmtflags f) const
+{
+   //
+   // Start with room for the digits requested plus the integer part when fixed, this is
+   // enough unless we've been asked for something strange:
+   //
+   std::size_t size = static_cast<std::size_t>(dig > 0 ? dig : std::numeric_limits<number<cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> > >::max_digits10) + 32;
+   if ((f & std::ios_base::fixed) && (exponent() > 0) && (exponent() <= cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::max_exponent))
+      size += static_cast<std::size_t>(0.30103 * exponent());
+   std::string s(size, '\0');
+   char*       p;
+   while (!(p = to_chars(&s[0], &s[0] + s.size(), dig, f)))
+      s.resize(2 * s.size());
+   s.erase(p - &s[0]);
+   return s;
+}
 
-      boost::multiprecision::detail::format_float_string(s, base10_exp, dig, f, false);
-   }
-   else
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline to_chars_result eval_to_chars(char* first, char* last, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   to_chars_result result = {last, std::errc::value_too_large};
+   if (char* p = val.to_chars(first, last, digits, f))
    {
-      switch (exponent())
-      {
-      case exponent_zero:
-         s = sign() ? "-0" : f & std::ios_base::showpos ? "+0" : "0";
-         boost::multiprecision::detail::format_float_string(s, 0, dig, f, true);
-         break;
-      case exponent_nan:
-         s = "nan";
-         break;
-      case exponent_infinity:
-         s = sign() ? "-inf" : f & std::ios_base::showpos ? "+inf" : "inf";
-         break;
-      }
+      result.ptr = p;
+      result.ec  = std::errc();
    }
-   return s;
+   return result;
 }
+#endif
 
 #ifdef BOOST_MSVC
 #pragma warning(pop)
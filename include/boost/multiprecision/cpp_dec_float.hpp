@@ -513,6 +513,10 @@ class cpp_dec_float
    }
 
    std::string str(boost::intmax_t digits, std::ios_base::fmtflags f) const;
+   //
+   // As str(), but writes to [first, last), returns a null pointer if there is not enough room:
+   //
+   char* to_chars(char* first, char* last, boost::intmax_t digits, std::ios_base::fmtflags f) const;
 
    int compare(const cpp_dec_float& v) const;
 
@@ -1773,23 +1777,18 @@ cpp_dec_float<Digits10, ExponentType, Allocator> cpp_dec_float<Digits10, Exponen
 }
 
 template <unsigned Digits10, class ExponentType, class Allocator>
-std::string cpp_dec_float<Digits10, ExponentType, Allocator>::str(boost::intmax_t number_of_digits, std::ios_base::fmtflags f) const
+char* cpp_dec_float<Digits10, ExponentType, Allocator>::to_chars(char* first, char* last, boost::intmax_t number_of_digits, std::ios_base::fmtflags f) const
 {
-   if ((this->isinf)())
+   if ((this->isinf)() || (this->isnan)())
    {
-      if (this->isneg())
-         return "-inf";
-      else if (f & std::ios_base::showpos)
-         return "+inf";
-      else
-         return "inf";
-   }
-   else if ((this->isnan)())
-   {
-      return "nan";
+      const char* special = (this->isnan)() ? "nan" : this->isneg() ? "-inf" : (f & std::ios_base::showpos) ? "+inf" : "inf";
+      std::size_t size    = std::strlen(special);
+      if (size > static_cast<std::size_t>(last - first))
+         return 0;
+      std::memcpy(first, special, size);
+      return first + size;
    }
 
-   std::string     str;
    boost::intmax_t org_digits(number_of_digits);
    ExponentType    my_exp = order();
 
@@ -1806,108 +1805,126 @@ std::string cpp_dec_float<Digits10, ExponentType, Allocator>::str(boost::intmax_
    const std::size_t number_of_elements = (std::min)(static_cast<std::size_t>((number_of_digits / static_cast<std::size_t>(cpp_dec_float_elem_digits10)) + 2u),
                                                      static_cast<std::size_t>(cpp_dec_float_elem_number));
 
-   // Extract the remaining digits from cpp_dec_float<Digits10, ExponentType, Allocator> after the decimal point.
-   std::stringstream ss;
-   ss.imbue(std::locale::classic());
-   ss << data[0];
-   // Extract all of the digits from cpp_dec_float<Digits10, ExponentType, Allocator>, beginning with the first data element.
-   for (std::size_t i = static_cast<std::size_t>(1u); i < number_of_elements; i++)
-   {
-      ss << std::setw(static_cast<std::streamsize>(cpp_dec_float_elem_digits10))
-         << std::setfill(static_cast<char>('0'))
-         << data[i];
-   }
-   str += ss.str();
-
-   bool have_leading_zeros = false;
+   bool        have_leading_zeros = false;
+   std::size_t leading_zeros      = 0;
 
    if (number_of_digits == 0)
    {
       // We only get here if the output format is "fixed" and we just need to
       // round the first non-zero digit.
       number_of_digits -= my_exp + 1; // reset to original value
-      str.insert(static_cast<std::string::size_type>(0), std::string::size_type(number_of_digits), '0');
+      leading_zeros      = static_cast<std::size_t>(number_of_digits);
       have_leading_zeros = true;
    }
 
    if (number_of_digits < 0)
    {
-      str = "0";
-      if (isneg())
-         str.insert(static_cast<std::string::size_type>(0), 1, '-');
-      boost::multiprecision::detail::format_float_string(str, 0, number_of_digits - my_exp - 1, f, this->iszero());
-      return str;
+      return boost::multiprecision::detail::format_float_chars(first, last, "0", 1, isneg(), 0, number_of_digits - my_exp - 1, f, this->iszero());
    }
-   else
+
+   // Extract all of the digits from cpp_dec_float<Digits10, ExponentType, Allocator>, beginning with the first data element,
+   // into a local buffer if it's large enough:
+   char              local[256];
+   std::vector<char> storage;
+   std::size_t       size = leading_zeros + number_of_elements * cpp_dec_float_elem_digits10;
+   char*             str  = local;
+   if (size > sizeof(local))
    {
-      // Cut the output to the size of the precision.
-      if (str.length() > static_cast<std::string::size_type>(number_of_digits))
+      storage.resize(size);
+      str = &storage[0];
+   }
+   std::memset(str, '0', leading_zeros);
+   char* p = str + leading_zeros;
+   {
+      char            buf[cpp_dec_float_elem_digits10];
+      char*           q = buf + cpp_dec_float_elem_digits10;
+      boost::uint32_t v = data[0];
+      do
       {
-         // Get the digit after the last needed digit for rounding
-         const boost::uint32_t round = static_cast<boost::uint32_t>(static_cast<boost::uint32_t>(str[static_cast<std::string::size_type>(number_of_digits)]) - static_cast<boost::uint32_t>('0'));
+         *--q = static_cast<char>('0' + v % 10u);
+         v /= 10u;
+      } while (v);
+      std::memcpy(p, q, buf + cpp_dec_float_elem_digits10 - q);
+      p += buf + cpp_dec_float_elem_digits10 - q;
+   }
+   for (std::size_t i = static_cast<std::size_t>(1u); i < number_of_elements; i++)
+   {
+      boost::uint32_t v = data[i];
+      for (boost::int32_t j = cpp_dec_float_elem_digits10; j-- > 0; v /= 10u)
+         p[j] = static_cast<char>('0' + v % 10u);
+      p += cpp_dec_float_elem_digits10;
+   }
+   std::size_t n = p - str;
+
+   // Cut the output to the size of the precision.
+   if (n > static_cast<std::size_t>(number_of_digits))
+   {
+      // Get the digit after the last needed digit for rounding
+      const boost::uint32_t round = static_cast<boost::uint32_t>(static_cast<boost::uint32_t>(str[static_cast<std::size_t>(number_of_digits)]) - static_cast<boost::uint32_t>('0'));
 
-         bool need_round_up = round >= 5u;
+      bool need_round_up = round >= 5u;
 
-         if (round == 5u)
+      if (round == 5u)
+      {
+         const boost::uint32_t ix = static_cast<boost::uint32_t>(static_cast<boost::uint32_t>(str[static_cast<std::size_t>(number_of_digits - 1)]) - static_cast<boost::uint32_t>('0'));
+         if ((ix & 1u) == 0)
          {
-            const boost::uint32_t ix = static_cast<boost::uint32_t>(static_cast<boost::uint32_t>(str[static_cast<std::string::size_type>(number_of_digits - 1)]) - static_cast<boost::uint32_t>('0'));
-            if ((ix & 1u) == 0)
+            // We have an even digit followed by a 5, so we might not actually need to round up
+            // if all the remaining digits are zero:
+            bool all_zeros = true;
+            for (std::size_t i = static_cast<std::size_t>(number_of_digits + 1); i < n; ++i)
             {
-               // We have an even digit followed by a 5, so we might not actually need to round up
-               // if all the remaining digits are zero:
-               if (str.find_first_not_of('0', static_cast<std::string::size_type>(number_of_digits + 1)) == std::string::npos)
+               if (str[i] != '0')
                {
-                  bool all_zeros = true;
-                  // No none-zero trailing digits in the string, now check whatever parts we didn't convert to the string:
-                  for (std::size_t i = number_of_elements; i < data.size(); i++)
-                  {
-                     if (data[i])
-                     {
-                        all_zeros = false;
-                        break;
-                     }
-                  }
-                  if (all_zeros)
-                     need_round_up = false; // tie break - round to even.
+                  all_zeros = false;
+                  break;
                }
             }
+            // No none-zero trailing digits in the string, now check whatever parts we didn't convert to the string:
+            for (std::size_t i = number_of_elements; all_zeros && (i < data.size()); i++)
+            {
+               if (data[i])
+                  all_zeros = false;
+            }
+            if (all_zeros)
+               need_round_up = false; // tie break - round to even.
          }
+      }
 
-         // Truncate the string
-         str.erase(static_cast<std::string::size_type>(number_of_digits));
+      // Truncate the string
+      n = static_cast<std::size_t>(number_of_digits);
 
-         if (need_round_up)
-         {
-            std::size_t ix = static_cast<std::size_t>(str.length() - 1u);
+      if (need_round_up)
+      {
+         std::size_t ix = n - 1u;
 
-            // Every trailing 9 must be rounded up
-            while (ix && (static_cast<boost::int32_t>(str.at(ix)) - static_cast<boost::int32_t>('0') == static_cast<boost::int32_t>(9)))
-            {
-               str.at(ix) = static_cast<char>('0');
-               --ix;
-            }
+         // Every trailing 9 must be rounded up
+         while (ix && (str[ix] == '9'))
+         {
+            str[ix] = '0';
+            --ix;
+         }
 
-            if (!ix)
+         if (!ix)
+         {
+            // There were nothing but trailing nines.
+            if (str[ix] == '9')
             {
-               // There were nothing but trailing nines.
-               if (static_cast<boost::int32_t>(static_cast<boost::int32_t>(str.at(ix)) - static_cast<boost::int32_t>(0x30)) == static_cast<boost::int32_t>(9))
-               {
-                  // Increment up to the next order and adjust exponent.
-                  str.at(ix) = static_cast<char>('1');
-                  ++my_exp;
-               }
-               else
-               {
-                  // Round up this digit.
-                  ++str.at(ix);
-               }
+               // Increment up to the next order and adjust exponent.
+               str[ix] = '1';
+               ++my_exp;
             }
             else
             {
-               // Round up the last digit.
+               // Round up this digit.
                ++str[ix];
             }
          }
+         else
+         {
+            // Round up the last digit.
+            ++str[ix];
+         }
       }
    }
 
@@ -1915,20 +1932,36 @@ std::string cpp_dec_float<Digits10, ExponentType, Allocator>::str(boost::intmax_
    {
       // We need to take the zeros back out again, and correct the exponent
       // if we rounded up:
-      if (str[std::string::size_type(number_of_digits - 1)] != '0')
+      std::size_t erase = static_cast<std::size_t>(number_of_digits);
+      if (str[erase - 1] != '0')
       {
          ++my_exp;
-         str.erase(0, std::string::size_type(number_of_digits - 1));
+         --erase;
       }
-      else
-         str.erase(0, std::string::size_type(number_of_digits));
+      erase = (std::min)(erase, n);
+      str += erase;
+      n -= erase;
    }
 
-   if (isneg())
-      str.insert(static_cast<std::string::size_type>(0), 1, '-');
+   return boost::multiprecision::detail::format_float_chars(first, last, str, n, isneg(), my_exp, org_digits, f, this->iszero());
+}
 
-   boost::multiprecision::detail::format_float_string(str, my_exp, org_digits, f, this->iszero());
-   return str;
+template <unsigned Digits10, class ExponentType, class Allocator>
+std::string cpp_dec_float<Digits10, ExponentType, Allocator>::str(boost::intmax_t number_of_digits, std::ios_base::fmtflags f) const
+{
+   //
+   // Start with room for the digits requested plus the integer part when fixed, this is
+   // enough unless we've been asked for something strange:
+   //
+   std::size_t size = static_cast<std::size_t>(number_of_digits > 0 ? number_of_digits : cpp_dec_float_total_digits10) + 32;
+   if ((f & std::ios_base::fixed) && (this->isfinite)() && (order() > 0))
+      size += static_cast<std::size_t>(order());
+   std::string s(size, '\0');
+   char*       p;
+   while (!(p = to_chars(&s[0], &s[0] + s.size(), number_of_digits, f)))
+      s.resize(2 * s.size());
+   s.erase(p - &s[0]);
+   return s;
 }
 
 template <unsigned Digits10, class ExponentType, class Allocator>
@@ -2704,6 +2737,20 @@ cpp_dec_float<Digits10, ExponentType, Allocator> cpp_dec_float<Digits10, Exponen
    }
 }
 
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+template <unsigned Digits10, class ExponentType, class Allocator>
+inline to_chars_result eval_to_chars(char* first, char* last, const cpp_dec_float<Digits10, ExponentType, Allocator>& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   to_chars_result result = {last, std::errc::value_too_large};
+   if (char* p = val.to_chars(first, last, digits, f))
+   {
+      result.ptr = p;
+      result.ec  = std::errc();
+   }
+   return result;
+}
+#endif
+
 template <unsigned Digits10, class ExponentType, class Allocator>
 inline void eval_add(cpp_dec_float<Digits10, ExponentType, Allocator>& result, const cpp_dec_float<Digits10, ExponentType, Allocator>& o)
 {
@@ -24,6 +24,7 @@
 #include <boost/type_traits/common_type.hpp>
 #include <boost/type_traits/make_signed.hpp>
 #include <boost/multiprecision/cpp_int/checked.hpp>
+#include <boost/multiprecision/cpp_int/pool_allocator.hpp>
 #include <boost/multiprecision/detail/constexpr.hpp>
 #ifdef BOOST_MP_USER_DEFINED_LITERALS
 #include <boost/multiprecision/cpp_int/value_pack.hpp>
@@ -159,6 +160,13 @@ inline BOOST_MP_CXX14_CONSTEXPR void verify_new_size(unsigned new_size, unsigned
 }
 inline BOOST_MP_CXX14_CONSTEXPR void verify_new_size(unsigned /*new_size*/, unsigned /*min_size*/, const mpl::int_<unchecked>&) {}
 
+//
+// Allocators which can extend a block of n limbs in place to hold at least new_size limbs
+// overload this to return the new capacity, zero means a new block is required:
+//
+template <class Allocator, class Pointer>
+inline unsigned expand_limbs_in_place(Allocator&, Pointer, unsigned, unsigned) { return 0; }
+
 template <class U>
 inline BOOST_MP_CXX14_CONSTEXPR void verify_limb_mask(bool b, U limb, U mask, const mpl::int_<checked>&)
 {
@@ -365,6 +373,18 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
       {
          // We must not be an alias, memory allocation here defeats the whole point of aliasing:
          BOOST_ASSERT(!m_alias);
+         // See if the allocator can grow the current buffer:
+         if (!m_internal)
+         {
+            using detail::expand_limbs_in_place;
+            unsigned expanded = expand_limbs_in_place(allocator(), m_data.ld.data, cap, new_size);
+            if (expanded)
+            {
+               m_limbs            = new_size;
+               m_data.ld.capacity = expanded;
+               return;
+            }
+         }
          // Allocate a new buffer and copy everything over:
          cap             = (std::min)((std::max)(cap * 4, new_size), max_limbs);
          limb_pointer pl = allocator().allocate(cap);
@@ -1591,9 +1611,9 @@ struct cpp_int_backend
    }
 
  private:
-   void do_assign_string(const char* s, const mpl::true_&)
+   void do_assign_string(const char* s, const char* e, const mpl::true_&)
    {
-      std::size_t n  = s ? std::strlen(s) : 0;
+      std::size_t n  = e - s;
       *this          = 0;
       unsigned radix = 10;
       bool     isneg = false;
@@ -1620,7 +1640,7 @@ struct cpp_int_backend
       if (n)
       {
          unsigned val;
-         while (*s)
+         while (s != e)
          {
             if (*s >= '0' && *s <= '9')
                val = *s - '0';
@@ -1642,11 +1662,9 @@ struct cpp_int_backend
       if (isneg)
          this->negate();
    }
-   void do_assign_string(const char* s, const mpl::false_&)
+   void do_assign_string(const char* s, const char* e, const mpl::false_&)
    {
-      using default_ops::eval_add;
-      using default_ops::eval_multiply;
-      std::size_t n  = s ? std::strlen(s) : 0;
+      std::size_t n  = e - s;
       *this          = static_cast<limb_type>(0u);
       unsigned radix = 10;
       bool     isneg = false;
@@ -1680,47 +1698,48 @@ struct cpp_int_backend
       {
          if (radix == 16)
          {
-            while (*s == '0')
+            while ((s != e) && (*s == '0'))
                ++s;
-            std::size_t bitcount = 4 * std::strlen(s);
-            limb_type   val;
-            std::size_t limb, shift;
-            if (bitcount > 4)
-               bitcount -= 4;
-            else
-               bitcount = 0;
-            std::size_t newsize = bitcount / (sizeof(limb_type) * CHAR_BIT) + 1;
+            //
+            // Each limb is assembled from its own block of hex digits, working
+            // back from the least significant end of the string:
+            //
+            const unsigned digits_per_limb = sizeof(limb_type) * CHAR_BIT / 4;
+            std::size_t    newsize         = (e - s + digits_per_limb - 1) / digits_per_limb;
+            if (!newsize)
+               newsize = 1;
             result.resize(static_cast<unsigned>(newsize), static_cast<unsigned>(newsize)); // will throw if this is a checked integer that cannot be resized
             std::memset(result.limbs(), 0, result.size() * sizeof(limb_type));
-            while (*s)
+            for (std::size_t limb = 0; e != s; ++limb)
             {
-               if (*s >= '0' && *s <= '9')
-                  val = *s - '0';
-               else if (*s >= 'a' && *s <= 'f')
-                  val = 10 + *s - 'a';
-               else if (*s >= 'A' && *s <= 'F')
-                  val = 10 + *s - 'A';
-               else
+               const char* p   = e - s > static_cast<std::ptrdiff_t>(digits_per_limb) ? e - digits_per_limb : s;
+               limb_type   val = 0;
+               for (const char* q = p; q != e; ++q)
                {
-                  BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
+                  limb_type digit;
+                  if (*q >= '0' && *q <= '9')
+                     digit = *q - '0';
+                  else if (*q >= 'a' && *q <= 'f')
+                     digit = 10 + *q - 'a';
+                  else if (*q >= 'A' && *q <= 'F')
+                     digit = 10 + *q - 'A';
+                  else
+                  {
+                     BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
+                  }
+                  val = (val << 4) | digit;
                }
-               limb  = bitcount / (sizeof(limb_type) * CHAR_BIT);
-               shift = bitcount % (sizeof(limb_type) * CHAR_BIT);
-               val <<= shift;
                if (result.size() > limb)
-               {
-                  result.limbs()[limb] |= val;
-               }
-               ++s;
-               bitcount -= 4;
+                  result.limbs()[limb] = val;
+               e = p;
             }
             result.normalize();
          }
          else if (radix == 8)
          {
-            while (*s == '0')
+            while ((s != e) && (*s == '0'))
                ++s;
-            std::size_t bitcount = 3 * std::strlen(s);
+            std::size_t bitcount = 3 * (e - s);
             limb_type   val;
             std::size_t limb, shift;
             if (bitcount > 3)
@@ -1730,7 +1749,7 @@ struct cpp_int_backend
             std::size_t newsize = bitcount / (sizeof(limb_type) * CHAR_BIT) + 1;
             result.resize(static_cast<unsigned>(newsize), static_cast<unsigned>(newsize)); // will throw if this is a checked integer that cannot be resized
             std::memset(result.limbs(), 0, result.size() * sizeof(limb_type));
-            while (*s)
+            while (s != e)
             {
                if (*s >= '0' && *s <= '7')
                   val = *s - '0';
@@ -1750,8 +1769,12 @@ struct cpp_int_backend
                      if (val)
                      {
                         // If this is the most-significant-limb, we may need to allocate an extra one for the overflow:
-                        if (limb + 1 == newsize)
+                        if ((limb + 1 == newsize) && (result.size() == newsize))
+                        {
                            result.resize(static_cast<unsigned>(newsize + 1), static_cast<unsigned>(newsize + 1));
+                           if (result.size() > newsize)
+                              result.limbs()[newsize] = 0;
+                        }
                         if (result.size() > limb + 1)
                         {
                            result.limbs()[limb + 1] |= val;
@@ -1766,30 +1789,7 @@ struct cpp_int_backend
          }
          else
          {
-            // Base 10, we extract blocks of size 10^9 at a time, that way
-            // the number of multiplications is kept to a minimum:
-            limb_type block_mult = max_block_10;
-            while (*s)
-            {
-               limb_type block = 0;
-               for (unsigned i = 0; i < digits_per_block_10; ++i)
-               {
-                  limb_type val;
-                  if (*s >= '0' && *s <= '9')
-                     val = *s - '0';
-                  else
-                     BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected character encountered in input."));
-                  block *= 10;
-                  block += val;
-                  if (!*++s)
-                  {
-                     block_mult = block_multiplier(i);
-                     break;
-                  }
-               }
-               eval_multiply(result, block_mult);
-               eval_add(result, block);
-            }
+            read_decimal_digits(result, s, e);
          }
       }
       if (isneg)
@@ -1800,7 +1800,15 @@ struct cpp_int_backend
  public:
    cpp_int_backend& operator=(const char* s)
    {
-      do_assign_string(s, trivial_tag());
+      do_assign_string(s, s ? s + std::strlen(s) : s, trivial_tag());
+      return *this;
+   }
+   //
+   // Assigns from the characters in [first, last), which need not be null-terminated:
+   //
+   cpp_int_backend& assign_string(const char* first, const char* last)
+   {
+      do_assign_string(first, last, trivial_tag());
       return *this;
    }
    BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void swap(cpp_int_backend& o) BOOST_NOEXCEPT
@@ -1913,100 +1921,15 @@ struct cpp_int_backend
    }
    std::string do_get_string(std::ios_base::fmtflags f, const mpl::false_&) const
    {
-      using default_ops::eval_get_sign;
-      int base = 10;
-      if ((f & std::ios_base::oct) == std::ios_base::oct)
-         base = 8;
-      else if ((f & std::ios_base::hex) == std::ios_base::hex)
-         base = 16;
-      std::string result;
-
-      unsigned Bits = this->size() * base_type::limb_bits;
-
-      if (base == 8 || base == 16)
-      {
-         if (this->sign())
-            BOOST_THROW_EXCEPTION(std::runtime_error("Base 8 or 16 printing of negative numbers is not supported."));
-         limb_type       shift = base == 8 ? 3 : 4;
-         limb_type       mask  = static_cast<limb_type>((1u << shift) - 1);
-         cpp_int_backend t(*this);
-         result.assign(Bits / shift + ((Bits % shift) ? 1 : 0), '0');
-         std::string::difference_type pos      = result.size() - 1;
-         char                         letter_a = f & std::ios_base::uppercase ? 'A' : 'a';
-         for (unsigned i = 0; i < Bits / shift; ++i)
-         {
-            char c = '0' + static_cast<char>(t.limbs()[0] & mask);
-            if (c > '9')
-               c += letter_a - '9' - 1;
-            result[pos--] = c;
-            eval_right_shift(t, shift);
-         }
-         if (Bits % shift)
-         {
-            mask   = static_cast<limb_type>((1u << (Bits % shift)) - 1);
-            char c = '0' + static_cast<char>(t.limbs()[0] & mask);
-            if (c > '9')
-               c += letter_a - '9';
-            result[pos] = c;
-         }
-         //
-         // Get rid of leading zeros:
-         //
-         std::string::size_type n = result.find_first_not_of('0');
-         if (!result.empty() && (n == std::string::npos))
-            n = result.size() - 1;
-         result.erase(0, n);
-         if (f & std::ios_base::showbase)
-         {
-            const char* pp = base == 8 ? "0" : (f & std::ios_base::uppercase) ? "0X" : "0x";
-            result.insert(static_cast<std::string::size_type>(0), pp);
-         }
-      }
-      else
-      {
-         result.assign(Bits / 3 + 1, '0');
-         std::string::difference_type pos = result.size() - 1;
-         cpp_int_backend              t(*this);
-         cpp_int_backend              r;
-         bool                         neg = false;
-         if (t.sign())
-         {
-            t.negate();
-            neg = true;
-         }
-         if (this->size() == 1)
-         {
-            result = boost::lexical_cast<std::string>(t.limbs()[0]);
-         }
-         else
-         {
-            cpp_int_backend block10;
-            block10 = max_block_10;
-            while (eval_get_sign(t) != 0)
-            {
-               cpp_int_backend t2;
-               divide_unsigned_helper(&t2, t, block10, r);
-               t           = t2;
-               limb_type v = r.limbs()[0];
-               for (unsigned i = 0; i < digits_per_block_10; ++i)
-               {
-                  char c = '0' + v % 10;
-                  v /= 10;
-                  result[pos] = c;
-                  if (pos-- == 0)
-                     break;
-               }
-            }
-         }
-         std::string::size_type n = result.find_first_not_of('0');
-         result.erase(0, n);
-         if (result.empty())
-            result = "0";
-         if (neg)
-            result.insert(static_cast<std::string::size_type>(0), 1, '-');
-         else if (f & std::ios_base::showpos)
-            result.insert(static_cast<std::string::size_type>(0), 1, '+');
-      }
+      if (this->sign() && (((f & std::ios_base::oct) == std::ios_base::oct) || ((f & std::ios_base::hex) == std::ios_base::hex)))
+         BOOST_THROW_EXCEPTION(std::runtime_error("Base 8 or 16 printing of negative numbers is not supported."));
+      //
+      // Room for Bits / 3 + 1 digits, plus a sign or base prefix:
+      //
+      std::string result(this->size() * base_type::limb_bits / 3 + 3, '0');
+      char*       p = write_integer_chars(&result[0], &result[0] + result.size(), *this, f, trivial_tag());
+      BOOST_ASSERT(p);
+      result.erase(p - &result[0]);
       return result;
    }
 
@@ -2195,6 +2118,9 @@ typedef number<cpp_int_backend<> >           cpp_int;
 typedef rational_adaptor<cpp_int_backend<> > cpp_rational_backend;
 typedef number<cpp_rational_backend>         cpp_rational;
 
+// Arbitrary precision integer whose limbs come from a per-thread pool:
+typedef number<cpp_int_backend<0, 0, signed_magnitude, unchecked, cpp_int_pool_allocator<limb_type> > > cpp_int_pooled;
+
 // Fixed precision unsigned types:
 typedef number<cpp_int_backend<128, 128, unsigned_magnitude, unchecked, void> >   uint128_t;
 typedef number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void> >   uint256_t;
@@ -2249,11 +2175,16 @@ struct is_explicitly_convertible<cpp_int_backend<MinBits, MaxBits, SignType, Che
 #include <boost/multiprecision/cpp_int/divide.hpp>
 #include <boost/multiprecision/cpp_int/bitwise.hpp>
 #include <boost/multiprecision/cpp_int/misc.hpp>
+#include <boost/multiprecision/cpp_int/radix.hpp>
 #include <boost/multiprecision/cpp_int/limits.hpp>
 #ifdef BOOST_MP_USER_DEFINED_LITERALS
 #include <boost/multiprecision/cpp_int/literals.hpp>
 #endif
 #include <boost/multiprecision/cpp_int/serialize.hpp>
 #include <boost/multiprecision/cpp_int/import_export.hpp>
+#include <boost/multiprecision/cpp_int/divisor.hpp>
+#include <boost/multiprecision/cpp_int/montgomery.hpp>
+#include <boost/multiprecision/cpp_int/constant_time.hpp>
+#include <boost/multiprecision/cpp_int/sqrt.hpp>
 
 #endif
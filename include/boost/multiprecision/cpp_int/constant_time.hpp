@@ -0,0 +1,303 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Operations on fixed precision unsigned cpp_int whose running time and memory access
+// pattern do not depend on the values of their arguments, selected by passing the
+// constant_time tag.  Every loop runs over the full width of the type regardless of
+// size(), and conditionals on data are replaced by masks.  The modulus passed to
+// powm is treated as public.
+//
+#ifndef BOOST_MP_CPP_INT_CONSTANT_TIME_HPP
+#define BOOST_MP_CPP_INT_CONSTANT_TIME_HPP
+
+namespace boost { namespace multiprecision {
+
+struct constant_time_t
+{};
+
+static const constant_time_t constant_time = constant_time_t();
+
+namespace backends {
+
+namespace detail {
+
+//
+// All ones if the bit c is 1, otherwise zero:
+//
+inline limb_type constant_time_mask(limb_type c)
+{
+   return static_cast<limb_type>(0u) - c;
+}
+//
+// Returns 1 if a is non-zero, otherwise 0, as the top bit of a | -a:
+//
+inline limb_type constant_time_nonzero(limb_type a)
+{
+   return (a | (static_cast<limb_type>(0u) - a)) >> (sizeof(limb_type) * CHAR_BIT - 1);
+}
+//
+// Returns 1 if a < b, otherwise 0, without a comparison the compiler may turn into a branch,
+// see Hacker's Delight, 2-12:
+//
+inline limb_type constant_time_less(limb_type a, limb_type b)
+{
+   return (a ^ ((a ^ b) | ((a - b) ^ b))) >> (sizeof(limb_type) * CHAR_BIT - 1);
+}
+//
+// Zeros n limbs at p on destruction, through a volatile pointer so that the stores are not
+// removed as dead, used for workspace which has held secret values:
+//
+class constant_time_scrubber
+{
+   limb_type* m_data;
+   unsigned   m_size;
+
+   constant_time_scrubber(const constant_time_scrubber&);
+   constant_time_scrubber& operator=(const constant_time_scrubber&);
+
+ public:
+   constant_time_scrubber(limb_type* p, unsigned n) : m_data(p), m_size(n) {}
+   ~constant_time_scrubber()
+   {
+      volatile limb_type* p = m_data;
+      for (unsigned i = 0; i < m_size; ++i)
+         p[i] = 0;
+   }
+};
+//
+// Copies all s limbs of x's storage to r, with those above x.size() set to zero:
+//
+template <class CppInt>
+inline void constant_time_load(limb_type* r, const CppInt& x, unsigned s)
+{
+   const limb_type* p = x.limbs();
+   unsigned         n = x.size();
+   for (unsigned i = 0; i < s; ++i)
+      r[i] = p[i] & constant_time_mask(constant_time_less(i, n));
+}
+//
+// Sets x to the s limb value p, normalising without a data dependent loop:
+//
+template <class CppInt>
+inline void constant_time_store(CppInt& x, const limb_type* p, unsigned s)
+{
+   x.resize(s, s);
+   limb_type* r    = x.limbs();
+   unsigned   size = 1;
+   for (unsigned i = 0; i < s; ++i)
+   {
+      r[i] = p[i];
+      size ^= (size ^ (i + 1)) & static_cast<unsigned>(constant_time_mask(constant_time_nonzero(p[i])));
+   }
+   x.resize(size, size);
+}
+//
+// Branch free form of montgomery_final_subtract, t needs room for s limbs:
+//
+inline void constant_time_final_subtract(limb_type* r, limb_type overflow, const limb_type* n, unsigned s, limb_type* t)
+{
+   limb_type borrow = 0;
+   for (unsigned i = 0; i < s; ++i)
+   {
+      limb_type l = r[i];
+      limb_type d = l - n[i];
+      limb_type b = constant_time_less(l, n[i]);
+      t[i]        = d - borrow;
+      borrow      = b | constant_time_less(d, borrow);
+   }
+   limb_type mask = constant_time_mask(constant_time_nonzero(overflow | (borrow ^ 1u)));
+   for (unsigned i = 0; i < s; ++i)
+      r[i] = (t[i] & mask) | (r[i] & ~mask);
+}
+//
+// Sets r[0, s) = a * b / B^s mod n for full width a, b, r needs room for 2s + 2 limbs:
+//
+inline void constant_time_montgomery_multiply(limb_type* r, const limb_type* a, const limb_type* b, const limb_type* n, unsigned s, limb_type n_inv)
+{
+   montgomery_cios_limbs(r, a, s, b, s, n, s, n_inv);
+   constant_time_final_subtract(r, r[s], n, s, r + s + 2);
+}
+
+} // namespace detail
+
+//
+// Sets result = a^p mod c for odd c, using Montgomery multiplication with a fixed 4-bit
+// window over every bit of p, and selecting each table entry by reading all of them.
+// Since R = B^s for the full width s, any a < R may be brought into Montgomery form
+// without a prior reduction modulo c:
+//
+template <unsigned Bits, cpp_int_check_type Checked>
+inline typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void> >::value>::type
+eval_powm(cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>&       result,
+          const cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& a,
+          const cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& p,
+          const cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& c,
+          const constant_time_t&)
+{
+   typedef cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void> backend_type;
+   typedef montgomery_context::value_type                                  value_type;
+
+   const unsigned s         = backend_type::internal_limb_count;
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const unsigned w         = 4;
+
+   if (!(*c.limbs() & 1u))
+      BOOST_THROW_EXCEPTION(std::domain_error("Constant time powm requires an odd modulus."));
+
+   std::vector<limb_type>         storage((16 + 7) * s + 2);
+   detail::constant_time_scrubber scrub(&storage[0], static_cast<unsigned>(storage.size()));
+   limb_type*                     table = &storage[0];
+   limb_type*                     n     = table + 16 * s;
+   limb_type*                     r2    = n + s;
+   limb_type*                     x     = r2 + s;
+   limb_type*                     y     = x + s;
+   limb_type*                     e     = y + s;
+   limb_type*                     t     = e + s; // 2s + 2 limbs
+
+   detail::constant_time_load(n, c, s);
+   detail::constant_time_load(e, p, s);
+   limb_type n_inv = montgomery_inverse_limb(n[0]);
+   //
+   // R^2 mod c depends only on the modulus:
+   //
+   value_type c_t(c.limbs(), 0, c.size()), big, rem;
+   big.resize(2 * s + 1, 2 * s + 1);
+   std::memset(big.limbs(), 0, 2 * s * sizeof(limb_type));
+   big.limbs()[2 * s] = 1;
+   eval_modulus(rem, big, c_t);
+   detail::constant_time_load(r2, rem, s);
+   //
+   // table[k] = a^k in Montgomery form:
+   //
+   std::memset(x, 0, s * sizeof(limb_type));
+   x[0] = 1;
+   detail::constant_time_montgomery_multiply(t, x, r2, n, s, n_inv);
+   std::memcpy(table, t, s * sizeof(limb_type));
+   detail::constant_time_load(x, a, s);
+   detail::constant_time_montgomery_multiply(t, x, r2, n, s, n_inv);
+   std::memcpy(table + s, t, s * sizeof(limb_type));
+   for (unsigned k = 2; k < 16; ++k)
+   {
+      detail::constant_time_montgomery_multiply(t, table + (k - 1) * s, table + s, n, s, n_inv);
+      std::memcpy(table + k * s, t, s * sizeof(limb_type));
+   }
+
+   std::memcpy(x, table, s * sizeof(limb_type));
+   for (unsigned i = s * limb_bits; i > 0;)
+   {
+      i -= w;
+      for (unsigned j = 0; j < w; ++j)
+      {
+         detail::constant_time_montgomery_multiply(t, x, x, n, s, n_inv);
+         std::memcpy(x, t, s * sizeof(limb_type));
+      }
+      limb_type digit = (e[i / limb_bits] >> (i % limb_bits)) & 15u;
+      std::memset(y, 0, s * sizeof(limb_type));
+      for (unsigned k = 0; k < 16; ++k)
+      {
+         limb_type mask = detail::constant_time_mask(detail::constant_time_nonzero(k ^ digit) ^ 1u);
+         for (unsigned l = 0; l < s; ++l)
+            y[l] |= table[k * s + l] & mask;
+      }
+      detail::constant_time_montgomery_multiply(t, x, y, n, s, n_inv);
+      std::memcpy(x, t, s * sizeof(limb_type));
+   }
+   //
+   // Out of Montgomery form:
+   //
+   std::memset(y, 0, s * sizeof(limb_type));
+   y[0] = 1;
+   detail::constant_time_montgomery_multiply(t, x, y, n, s, n_inv);
+   detail::constant_time_store(result, t, s);
+}
+
+//
+// Returns the sign of a - b:
+//
+template <unsigned Bits, cpp_int_check_type Checked>
+inline typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void> >::value, int>::type
+eval_compare(const cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& a,
+             const cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& b,
+             const constant_time_t&)
+{
+   const unsigned                 s = cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>::internal_limb_count;
+   limb_type                      x[s], y[s];
+   detail::constant_time_scrubber scrub_x(x, s), scrub_y(y, s);
+   detail::constant_time_load(x, a, s);
+   detail::constant_time_load(y, b, s);
+   //
+   // The most significant differing limb decides, so work upwards letting each
+   // difference overwrite the last:
+   //
+   limb_type result = 0;
+   for (unsigned i = 0; i < s; ++i)
+   {
+      limb_type gt   = detail::constant_time_less(y[i], x[i]);
+      limb_type lt   = detail::constant_time_less(x[i], y[i]);
+      limb_type mask = static_cast<limb_type>(0u) - (gt | lt);
+      result         = (result & ~mask) | ((gt - lt) & mask);
+   }
+   return static_cast<int>(static_cast<signed_limb_type>(result));
+}
+
+//
+// Swaps a and b if c is true:
+//
+template <unsigned Bits, cpp_int_check_type Checked>
+inline typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void> >::value>::type
+eval_conditional_swap(cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& a,
+                      cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>& b,
+                      bool                                                            c,
+                      const constant_time_t&)
+{
+   const unsigned                 s = cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>::internal_limb_count;
+   limb_type                      x[s], y[s];
+   detail::constant_time_scrubber scrub_x(x, s), scrub_y(y, s);
+   detail::constant_time_load(x, a, s);
+   detail::constant_time_load(y, b, s);
+   limb_type mask = detail::constant_time_mask(static_cast<limb_type>(c));
+   for (unsigned i = 0; i < s; ++i)
+   {
+      limb_type d = (x[i] ^ y[i]) & mask;
+      x[i] ^= d;
+      y[i] ^= d;
+   }
+   detail::constant_time_store(a, x, s);
+   detail::constant_time_store(b, y, s);
+}
+
+} // namespace backends
+
+template <unsigned Bits, cpp_int_check_type Checked, expression_template_option ExpressionTemplates>
+inline number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>
+powm(const number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& a,
+     const number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& p,
+     const number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& c,
+     const constant_time_t& tag)
+{
+   number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates> result;
+   eval_powm(result.backend(), a.backend(), p.backend(), c.backend(), tag);
+   return result;
+}
+
+template <unsigned Bits, cpp_int_check_type Checked, expression_template_option ExpressionTemplates>
+inline int compare(const number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& a,
+                   const number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& b,
+                   const constant_time_t&                                                                            tag)
+{
+   return eval_compare(a.backend(), b.backend(), tag);
+}
+
+template <unsigned Bits, cpp_int_check_type Checked, expression_template_option ExpressionTemplates>
+inline void conditional_swap(number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& a,
+                             number<cpp_int_backend<Bits, Bits, unsigned_magnitude, Checked, void>, ExpressionTemplates>& b,
+                             bool c, const constant_time_t& tag)
+{
+   eval_conditional_swap(a.backend(), b.backend(), c, tag);
+}
+
+}} // namespace boost::multiprecision
+
+#endif
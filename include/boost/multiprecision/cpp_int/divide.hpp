@@ -10,6 +10,23 @@
 
 namespace boost { namespace multiprecision { namespace backends {
 
+//
+// Minimum number of limbs in the divisor (and in the quotient) for
+// Burnikel-Ziegler recursive division to beat schoolbook long division:
+//
+#ifdef BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF
+const size_t burnikel_ziegler_cutoff = BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF;
+#else
+const size_t burnikel_ziegler_cutoff = 80;
+#endif
+
+template <class CppInt1, class CppInt2, class CppInt3>
+void divide_unsigned_burnikel_ziegler(
+    CppInt1*       result,
+    const CppInt2& x,
+    const CppInt3& y,
+    CppInt1&       r);
+
 template <class CppInt1, class CppInt2, class CppInt3>
 BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
     CppInt1*       result,
@@ -103,6 +120,19 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
          return;
       }
    }
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(y_order) && (y_order >= burnikel_ziegler_cutoff) && (r_order - y_order >= burnikel_ziegler_cutoff))
+#else
+   if ((y_order >= burnikel_ziegler_cutoff) && (r_order - y_order >= burnikel_ziegler_cutoff))
+#endif
+   {
+      //
+      // Both divisor and quotient are large, divide and conquer so that
+      // the work is done by the subquadratic multiplication routines:
+      //
+      divide_unsigned_burnikel_ziegler(result, x, y, r);
+      return;
+   }
 
    CppInt1 t;
    bool    r_neg = false;
@@ -449,6 +479,176 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
    BOOST_ASSERT(r.compare(y) < 0); // remainder must be less than the divisor or our code has failed
 }
 
+//
+// Burnikel-Ziegler recursive division, see "Fast Recursive Division",
+// Christoph Burnikel and Joachim Ziegler, MPI-I-98-1-022, 1998.
+// All the work is done in a variable precision type, the divisor is
+// normalised so that its most significant bit is set, and the
+// recursion bottoms out in divide_unsigned_helper above.
+//
+// Returns an alias of the limbs of a at or above limb k (or zero):
+//
+template <class CppInt>
+inline CppInt bz_high_part(const CppInt& a, unsigned k)
+{
+   static const limb_type zero = 0;
+   return a.size() > k ? CppInt(a.limbs(), k, a.size() - k) : CppInt(&zero, 0, 1);
+}
+//
+// Returns an alias of the limbs of a below limb k:
+//
+template <class CppInt>
+inline CppInt bz_low_part(const CppInt& a, unsigned k)
+{
+   return CppInt(a.limbs(), 0, (std::min)(k, a.size()));
+}
+//
+// Sets z = hi * 2^(n * limb_bits) + lo where lo has at most n limbs:
+//
+template <class CppInt>
+void bz_compose(CppInt& z, const CppInt& hi, const CppInt& lo, unsigned n)
+{
+   BOOST_ASSERT((void*)&z != (void*)&hi);
+   BOOST_ASSERT(lo.size() <= n);
+   unsigned hs = hi.size();
+   unsigned ls = lo.size();
+   z.resize(n + hs, n + hs);
+   std::memcpy(z.limbs(), lo.limbs(), ls * sizeof(limb_type));
+   std::memset(z.limbs() + ls, 0, (n - ls) * sizeof(limb_type));
+   std::memcpy(z.limbs() + n, hi.limbs(), hs * sizeof(limb_type));
+   z.normalize();
+   z.sign(false);
+}
+
+template <class CppInt>
+void bz_divide_3n2n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, unsigned h);
+//
+// Divides a by b where b has exactly n limbs with the top bit set, and
+// a < b * 2^(n * limb_bits):
+//
+template <class CppInt>
+void bz_divide_2n1n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, unsigned n)
+{
+   if ((n & 1) || (n <= burnikel_ziegler_cutoff))
+   {
+      divide_unsigned_helper(&q, a, b, r);
+      return;
+   }
+   unsigned h = n / 2;
+   CppInt   q1, r1, t;
+   bz_divide_3n2n(q1, r1, bz_high_part(a, h), b, h);
+   bz_compose(t, r1, bz_low_part(a, h), h);
+   bz_divide_3n2n(r1, r, t, b, h);
+   bz_compose(q, q1, r1, h);
+}
+//
+// Divides a by b where b has exactly 2h limbs with the top bit set, and
+// a < b * 2^(h * limb_bits):
+//
+template <class CppInt>
+void bz_divide_3n2n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, unsigned h)
+{
+   const CppInt b1(bz_high_part(b, h)), b2(bz_low_part(b, h));
+   const CppInt a12(bz_high_part(a, h));
+   CppInt       r1, t;
+   if (bz_high_part(a, 2 * h).compare(b1) < 0)
+      bz_divide_2n1n(q, r1, a12, b1, h);
+   else
+   {
+      //
+      // Quotient estimate is 2^(h * limb_bits) - 1, the remainder is then
+      // a12 - q * b1 = a12 - b1 * 2^(h * limb_bits) + b1:
+      //
+      q.resize(h, h);
+      for (unsigned i = 0; i < h; ++i)
+         q.limbs()[i] = CppInt::max_limb_value;
+      q.sign(false);
+      bz_compose(t, b1, CppInt(), h);
+      r1 = a12;
+      eval_subtract(r1, t);
+      eval_add(r1, b1);
+   }
+   eval_multiply(t, q, b2);
+   bz_compose(r, r1, bz_low_part(a, h), h);
+   eval_subtract(r, t);
+   //
+   // The estimate is at most 2 too large:
+   //
+   while (r.sign())
+   {
+      eval_add(r, b);
+      eval_decrement(q);
+   }
+}
+
+//
+// Divides the magnitude of x by the magnitude of y:
+//
+template <class CppInt>
+void bz_divide(CppInt& q, CppInt& r, const CppInt& x, const CppInt& y)
+{
+   //
+   // Pick a block size n = j * 2^k >= y.size() with j <= burnikel_ziegler_cutoff,
+   // so that the recursion halves n all the way down to the base case:
+   //
+   unsigned s = y.size();
+   unsigned m = 1;
+   while (m * burnikel_ziegler_cutoff < s)
+      m <<= 1;
+   unsigned n     = ((s + m - 1) / m) * m;
+   unsigned shift = n * CppInt::limb_bits - 1 - eval_msb_imp(y);
+
+   CppInt a, b;
+   a = x;
+   b = y;
+   a.sign(false);
+   b.sign(false);
+   eval_left_shift(a, shift);
+   eval_left_shift(b, shift);
+   //
+   // Split a into t blocks of n limbs, with the top block less than b / 2:
+   //
+   unsigned t = (eval_msb_imp(a) + 1) / (n * CppInt::limb_bits) + 1;
+   if (t < 2)
+      t = 2;
+
+   const CppInt top(bz_high_part(a, (t - 2) * n));
+   CppInt       qi, z;
+   z = top;
+   q.resize((t - 1) * n, (t - 1) * n);
+   std::memset(q.limbs(), 0, q.size() * sizeof(limb_type));
+   q.sign(false);
+   for (unsigned i = t - 1; i-- > 0;)
+   {
+      bz_divide_2n1n(qi, r, z, b, n);
+      std::memcpy(q.limbs() + i * n, qi.limbs(), qi.size() * sizeof(limb_type));
+      if (i)
+      {
+         const CppInt lo(a.limbs(), (i - 1) * n, n);
+         bz_compose(z, r, lo, n);
+      }
+   }
+   q.normalize();
+   eval_right_shift(r, shift);
+}
+
+template <class CppInt1, class CppInt2, class CppInt3>
+void divide_unsigned_burnikel_ziegler(
+    CppInt1*       result,
+    const CppInt2& x,
+    const CppInt3& y,
+    CppInt1&       r)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   const variable_precision_type x_t(x.limbs(), 0, x.size()), y_t(y.limbs(), 0, y.size());
+   variable_precision_type       q, rem;
+   bz_divide(q, rem, x_t, y_t);
+   if (result)
+      *result = q;
+   r = rem;
+}
+
 template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, unsigned MinBits3, unsigned MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
 BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits3, MaxBits3, SignType3, Checked3, Allocator3> >::value>::type
 eval_divide(
@@ -0,0 +1,416 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Division of many values by the same cpp_int divisor.  The limb level
+// routines follow "Improved division by invariant integers",
+// Niels Moller and Torbjorn Granlund, IEEE Transactions on Computers, 2011.
+//
+#ifndef BOOST_MP_CPP_INT_DIVISOR_HPP
+#define BOOST_MP_CPP_INT_DIVISOR_HPP
+
+namespace boost { namespace multiprecision {
+
+namespace backends {
+
+//
+// Minimum number of limbs in the divisor for Barrett reduction to beat
+// schoolbook division with a precomputed reciprocal:
+//
+#ifdef BOOST_MP_BARRETT_CUTOFF
+const size_t barrett_cutoff = BOOST_MP_BARRETT_CUTOFF;
+#else
+const size_t barrett_cutoff = 100;
+#endif
+//
+// Returns floor((B^2 - 1) / d) - B for a normalised limb d, where B = 2^limb_bits:
+//
+inline limb_type reciprocal_2by1(limb_type d)
+{
+   BOOST_ASSERT(d >> (sizeof(limb_type) * CHAR_BIT - 1));
+   return static_cast<limb_type>(((static_cast<double_limb_type>(~d) << (sizeof(limb_type) * CHAR_BIT)) | ~static_cast<limb_type>(0u)) / d);
+}
+//
+// Returns floor((B^3 - 1) / (d1 * B + d0)) - B for normalised d1:
+//
+inline limb_type reciprocal_3by2(limb_type d1, limb_type d0)
+{
+   limb_type v = reciprocal_2by1(d1);
+   limb_type p = d1 * v + d0;
+   if (p < d0)
+   {
+      --v;
+      if (p >= d1)
+      {
+         --v;
+         p -= d1;
+      }
+      p -= d1;
+   }
+   double_limb_type t  = static_cast<double_limb_type>(d0) * v;
+   limb_type        t1 = static_cast<limb_type>(t >> (sizeof(limb_type) * CHAR_BIT));
+   limb_type        t0 = static_cast<limb_type>(t);
+   p += t1;
+   if (p < t1)
+   {
+      --v;
+      if ((p > d1) || ((p == d1) && (t0 >= d0)))
+         --v;
+   }
+   return v;
+}
+//
+// Divides (u1, u0) by d with u1 < d, returns the quotient and sets r to the remainder:
+//
+inline limb_type divide_2by1_preinv(limb_type& r, limb_type u1, limb_type u0, limb_type d, limb_type v)
+{
+   double_limb_type q  = static_cast<double_limb_type>(v) * u1 + ((static_cast<double_limb_type>(u1) << (sizeof(limb_type) * CHAR_BIT)) | u0);
+   limb_type        q1 = static_cast<limb_type>(q >> (sizeof(limb_type) * CHAR_BIT)) + 1;
+   limb_type        q0 = static_cast<limb_type>(q);
+   r                   = u0 - q1 * d;
+   if (r > q0)
+   {
+      --q1;
+      r += d;
+   }
+   if (r >= d)
+   {
+      ++q1;
+      r -= d;
+   }
+   return q1;
+}
+//
+// Divides (u2, u1, u0) by (d1, d0) with (u2, u1) < (d1, d0), returns the quotient
+// and sets r to the double limb remainder:
+//
+inline limb_type divide_3by2_preinv(double_limb_type& r, limb_type u2, limb_type u1, limb_type u0, limb_type d1, limb_type d0, limb_type v)
+{
+   const unsigned         limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const double_limb_type d         = (static_cast<double_limb_type>(d1) << limb_bits) | d0;
+   double_limb_type       q         = static_cast<double_limb_type>(v) * u2 + ((static_cast<double_limb_type>(u2) << limb_bits) | u1);
+   limb_type              q1        = static_cast<limb_type>(q >> limb_bits);
+   limb_type              q0        = static_cast<limb_type>(q);
+   limb_type              r1        = u1 - q1 * d1;
+   r                                = ((static_cast<double_limb_type>(r1) << limb_bits) | u0) - d - static_cast<double_limb_type>(d0) * q1;
+   ++q1;
+   if (static_cast<limb_type>(r >> limb_bits) >= q0)
+   {
+      --q1;
+      r += d;
+   }
+   if (r >= d)
+   {
+      ++q1;
+      r -= d;
+   }
+   return q1;
+}
+//
+// Sets r = a << shift and returns the bits shifted out, 0 <= shift < limb_bits:
+//
+inline limb_type left_shift_limbs(limb_type* r, const limb_type* a, unsigned n, unsigned shift)
+{
+   if (!shift)
+   {
+      std::memmove(r, a, n * sizeof(limb_type));
+      return 0;
+   }
+   limb_type carry = 0;
+   for (unsigned i = 0; i < n; ++i)
+   {
+      limb_type l = a[i];
+      r[i]        = (l << shift) | carry;
+      carry       = l >> (sizeof(limb_type) * CHAR_BIT - shift);
+   }
+   return carry;
+}
+//
+// Divides the normalised numerator u[0, un] in place by the normalised divisor
+// d[0, dn) where dn >= 2 and the top dn limbs of u are less than d.  Stores the
+// un - dn + 1 quotient limbs in q if it is non-null, and leaves the remainder
+// in u[0, dn):
+//
+inline void divide_schoolbook_preinv(limb_type* q, limb_type* u, unsigned un, const limb_type* d, unsigned dn, limb_type v)
+{
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   limb_type      d1        = d[dn - 1];
+   limb_type      d0        = d[dn - 2];
+   for (unsigned j = un - dn + 1; j-- > 0;)
+   {
+      limb_type        qj;
+      limb_type        borrow = 0;
+      double_limb_type carry;
+      if ((u[j + dn] == d1) && (u[j + dn - 1] == d0))
+      {
+         //
+         // The quotient limb is B - 1 and is exact:
+         //
+         qj = ~static_cast<limb_type>(0u);
+         for (unsigned i = 0; i < dn; ++i)
+         {
+            carry        = static_cast<double_limb_type>(d[i]) * qj + borrow;
+            limb_type lo = static_cast<limb_type>(carry);
+            borrow       = static_cast<limb_type>(carry >> limb_bits) + (u[j + i] < lo);
+            u[j + i] -= lo;
+         }
+         u[j + dn] -= borrow;
+         BOOST_ASSERT(u[j + dn] == 0);
+      }
+      else
+      {
+         double_limb_type r;
+         qj = divide_3by2_preinv(r, u[j + dn], u[j + dn - 1], u[j + dn - 2], d1, d0, v);
+         //
+         // Subtract qj times the low dn - 2 limbs of d, the top two are already accounted for in r:
+         //
+         for (unsigned i = 0; i + 2 < dn; ++i)
+         {
+            carry        = static_cast<double_limb_type>(d[i]) * qj + borrow;
+            limb_type lo = static_cast<limb_type>(carry);
+            borrow       = static_cast<limb_type>(carry >> limb_bits) + (u[j + i] < lo);
+            u[j + i] -= lo;
+         }
+         if (r < borrow)
+         {
+            //
+            // Estimate was one too large, add back:
+            //
+            --qj;
+            carry = 0;
+            for (unsigned i = 0; i + 2 < dn; ++i)
+            {
+               carry += static_cast<double_limb_type>(u[j + i]) + d[i];
+               u[j + i] = static_cast<limb_type>(carry);
+               carry >>= limb_bits;
+            }
+            r += ((static_cast<double_limb_type>(d1) << limb_bits) | d0) + carry;
+         }
+         r -= borrow;
+         u[j + dn - 2] = static_cast<limb_type>(r);
+         u[j + dn - 1] = static_cast<limb_type>(r >> limb_bits);
+         u[j + dn]     = 0;
+      }
+      if (q)
+         q[j] = qj;
+   }
+}
+
+} // namespace backends
+
+template <class Integer>
+class divisor;
+
+//
+// Stores a cpp_int divisor along with its normalised form and precomputed
+// reciprocal, so that repeated division by the same value avoids redoing that work:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class divisor<number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> >
+{
+ public:
+   typedef number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> value_type;
+
+ private:
+   typedef cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>                backend_type;
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   BOOST_STATIC_ASSERT_MSG(!backends::is_trivial_cpp_int<backend_type>::value, "divisor requires a cpp_int type which stores its value in limbs.");
+
+   value_type              m_value;
+   variable_precision_type m_norm, m_mu;
+   unsigned                m_shift;
+   limb_type               m_inverse;
+
+ public:
+   explicit divisor(const value_type& d) : m_value(d), m_shift(0), m_inverse(0)
+   {
+      using default_ops::eval_is_zero;
+      if (eval_is_zero(d.backend()))
+      {
+         BOOST_THROW_EXCEPTION(std::overflow_error("Integer Division by zero."));
+      }
+      const backend_type& b  = d.backend();
+      unsigned            dn = b.size();
+      m_shift                = sizeof(limb_type) * CHAR_BIT - 1 - boost::multiprecision::detail::find_msb(b.limbs()[dn - 1]);
+      m_norm.resize(dn, dn);
+      backends::left_shift_limbs(m_norm.limbs(), b.limbs(), dn, m_shift);
+      if (dn == 1)
+         m_inverse = backends::reciprocal_2by1(m_norm.limbs()[0]);
+      else if (dn < backends::barrett_cutoff)
+         m_inverse = backends::reciprocal_3by2(m_norm.limbs()[dn - 1], m_norm.limbs()[dn - 2]);
+      else
+      {
+         //
+         // Barrett reduction: mu = floor(B^(2 * dn) / norm), this is a one off cost
+         // so we just use regular (and for these sizes recursive) division:
+         //
+         variable_precision_type p, r;
+         p.resize(2 * dn + 1, 2 * dn + 1);
+         std::memset(p.limbs(), 0, 2 * dn * sizeof(limb_type));
+         p.limbs()[2 * dn] = 1;
+         backends::divide_unsigned_helper(&m_mu, p, m_norm, r);
+      }
+   }
+
+   const value_type& value() const { return m_value; }
+
+   value_type divide(const value_type& x) const
+   {
+      variable_precision_type q, r;
+      divide_unsigned(x.backend(), &q, r);
+      value_type result;
+      result.backend() = q;
+      if ((x.sign() < 0) != (m_value.sign() < 0))
+         result.backend().negate();
+      return result;
+   }
+   value_type mod(const value_type& x) const
+   {
+      variable_precision_type r;
+      divide_unsigned(x.backend(), 0, r);
+      value_type result;
+      result.backend() = r;
+      if (x.sign() < 0)
+         result.backend().negate();
+      return result;
+   }
+   void qr(const value_type& x, value_type& q, value_type& r) const
+   {
+      variable_precision_type qt, rt;
+      bool                    q_neg = (x.sign() < 0) != (m_value.sign() < 0);
+      bool                    r_neg = x.sign() < 0;
+      divide_unsigned(x.backend(), &qt, rt);
+      q.backend() = qt;
+      r.backend() = rt;
+      if (q_neg)
+         q.backend().negate();
+      if (r_neg)
+         r.backend().negate();
+   }
+
+ private:
+   //
+   // Divides the magnitude of x by the magnitude of the divisor:
+   //
+   void divide_unsigned(const backend_type& x, variable_precision_type* q, variable_precision_type& r) const
+   {
+      unsigned xs = x.size();
+      unsigned dn = m_norm.size();
+      if ((xs < dn) || ((xs == dn) && (x.compare_unsigned(m_value.backend()) < 0)))
+      {
+         const variable_precision_type x_t(x.limbs(), 0, xs);
+         r = x_t;
+         r.sign(false);
+         if (q)
+            *q = static_cast<limb_type>(0u);
+         return;
+      }
+      if (dn == 1)
+      {
+         //
+         // Single limb divisor, the numerator is shifted on the fly:
+         //
+         const limb_type* px  = x.limbs();
+         limb_type        d   = m_norm.limbs()[0];
+         limb_type        rem = m_shift ? px[xs - 1] >> (sizeof(limb_type) * CHAR_BIT - m_shift) : 0;
+         limb_type*       pq  = 0;
+         if (q)
+         {
+            q->resize(xs, xs);
+            pq = q->limbs();
+         }
+         for (unsigned j = xs; j-- > 0;)
+         {
+            limb_type u  = m_shift && j ? (px[j] << m_shift) | (px[j - 1] >> (sizeof(limb_type) * CHAR_BIT - m_shift)) : px[j] << m_shift;
+            limb_type qj = backends::divide_2by1_preinv(rem, rem, u, d, m_inverse);
+            if (pq)
+               pq[j] = qj;
+         }
+         r = rem >> m_shift;
+         if (q)
+         {
+            q->normalize();
+            q->sign(false);
+         }
+         return;
+      }
+      variable_precision_type u;
+      u.resize(xs + 1, xs + 1);
+      u.limbs()[xs] = backends::left_shift_limbs(u.limbs(), x.limbs(), xs, m_shift);
+      if (dn < backends::barrett_cutoff)
+      {
+         if (q)
+            q->resize(xs - dn + 1, xs - dn + 1);
+         backends::divide_schoolbook_preinv(q ? q->limbs() : 0, u.limbs(), xs, m_norm.limbs(), dn, m_inverse);
+         u.resize(dn, dn);
+         u.normalize();
+         eval_right_shift(u, m_shift);
+         r = u;
+      }
+      else
+      {
+         u.normalize();
+         barrett_divide(q, r, u);
+         eval_right_shift(r, m_shift);
+      }
+      if (q)
+      {
+         q->normalize();
+         q->sign(false);
+      }
+   }
+   //
+   // Divides the normalised numerator a by m_norm, one block of dn limbs at a time:
+   //
+   void barrett_divide(variable_precision_type* q, variable_precision_type& r, const variable_precision_type& a) const
+   {
+      unsigned n = m_norm.size();
+      unsigned t = (a.size() + n - 1) / n;
+
+      const variable_precision_type top(backends::bz_high_part(a, (t - 1) * n));
+      variable_precision_type       qi, z;
+      z = top;
+      if (q)
+      {
+         q->resize(t * n, t * n);
+         std::memset(q->limbs(), 0, t * n * sizeof(limb_type));
+      }
+      for (unsigned i = t; i-- > 0;)
+      {
+         barrett_step(qi, r, z);
+         if (q)
+            std::memcpy(q->limbs() + i * n, qi.limbs(), qi.size() * sizeof(limb_type));
+         if (i)
+         {
+            const variable_precision_type lo(a.limbs(), (i - 1) * n, n);
+            backends::bz_compose(z, r, lo, n);
+         }
+      }
+   }
+   //
+   // Barrett reduction of z < m_norm * B^n, see the Handbook of Applied
+   // Cryptography, algorithm 14.42:
+   //
+   void barrett_step(variable_precision_type& q, variable_precision_type& r, const variable_precision_type& z) const
+   {
+      unsigned                n = m_norm.size();
+      variable_precision_type t;
+      eval_multiply(t, backends::bz_high_part(z, n - 1), m_mu);
+      const variable_precision_type t_high(backends::bz_high_part(t, n + 1));
+      q = t_high;
+      eval_multiply(t, q, m_norm);
+      r = z;
+      eval_subtract(r, t);
+      while (r.compare_unsigned(m_norm) >= 0)
+      {
+         eval_subtract(r, m_norm);
+         eval_increment(q);
+      }
+   }
+};
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -25,6 +25,21 @@
 
 namespace boost { namespace multiprecision { namespace backends {
 
+//
+// Number of limbs at which Lehmer's gcd algorithm takes over from binary gcd,
+// and at which the subquadratic half-gcd algorithm takes over from Lehmer's:
+//
+#ifdef BOOST_MP_LEHMER_GCD_CUTOFF
+const size_t lehmer_gcd_cutoff = BOOST_MP_LEHMER_GCD_CUTOFF;
+#else
+const size_t lehmer_gcd_cutoff = 4;
+#endif
+#ifdef BOOST_MP_HGCD_CUTOFF
+const size_t hgcd_cutoff = BOOST_MP_HGCD_CUTOFF;
+#else
+const size_t hgcd_cutoff = 600;
+#endif
+
 template <class T, bool has_limits = std::numeric_limits<T>::is_specialized>
 struct numeric_limits_workaround : public std::numeric_limits<T>
 {
@@ -496,6 +511,424 @@ eval_gcd(
    eval_gcd(result, a, static_cast<limb_type>(v < 0 ? -v : v));
 }
 
+//
+// Lehmer's algorithm: a run of Euclid steps on u and v is computed from their leading
+// 2 limbs alone, and then applied to u and v in a single pass.  The cofactors of the
+// run take (u, v) to (a * u - b * v, d * v - c * u), or to (b * v - a * u, c * u - d * v)
+// when odd is set:
+//
+struct lehmer_matrix
+{
+   limb_type a, b, c, d;
+   bool      odd;
+};
+//
+// Returns floor(x / 2^k), which must fit in a double limb:
+//
+template <class CppInt>
+inline double_limb_type gcd_leading_bits(const CppInt& x, unsigned k)
+{
+   unsigned         i = k / CppInt::limb_bits;
+   unsigned         s = k % CppInt::limb_bits;
+   unsigned         n = x.size();
+   const limb_type* p = x.limbs();
+   double_limb_type r = 0;
+   if (i < n)
+      r = p[i] >> s;
+   if (i + 1 < n)
+      r |= static_cast<double_limb_type>(p[i + 1]) << (CppInt::limb_bits - s);
+   if (s && (i + 2 < n))
+      r |= static_cast<double_limb_type>(p[i + 2]) << (2 * CppInt::limb_bits - s);
+   return r;
+}
+//
+// Returns true if q == n / d for q < 2^limb_bits, checked by multiplication as that is
+// much cheaper than a second double limb division:
+//
+inline bool gcd_check_quotient(double_limb_type q, double_limb_type n, double_limb_type d)
+{
+   const unsigned   limb_bits = sizeof(limb_type) * CHAR_BIT;
+   double_limb_type hi        = q * (d >> limb_bits);
+   double_limb_type lo        = q * static_cast<limb_type>(d);
+   if (hi >> limb_bits)
+      return false;
+   double_limb_type qd = (hi << limb_bits) + lo;
+   if ((qd < lo) || (qd > n))
+      return false;
+   return n - qd < d;
+}
+//
+// This is Knuth's Algorithm L (TAOCP vol 2, 4.5.2): with x and y the leading bits of u and v,
+// a quotient is only accepted if it is the same for both bounds on u / v.  We stop when the
+// cofactors no longer fit in a limb.  Requires u >= v, returns false if not even one step
+// could be taken:
+//
+template <class CppInt>
+bool lehmer_cofactors(const CppInt& u, const CppInt& v, lehmer_matrix& m)
+{
+   const unsigned bits  = 2 * CppInt::limb_bits - 2;
+   unsigned       ubits = eval_msb_imp(u) + 1;
+   unsigned       k     = ubits > bits ? ubits - bits : 0;
+
+   signed_double_limb_type x = static_cast<signed_double_limb_type>(gcd_leading_bits(u, k));
+   signed_double_limb_type y = static_cast<signed_double_limb_type>(gcd_leading_bits(v, k));
+   double_limb_type        a(1), b(0), c(0), d(1);
+   bool                    odd = false;
+   for (;;)
+   {
+      signed_double_limb_type n1, d1, n2, d2;
+      if (odd)
+      {
+         if ((y <= static_cast<signed_double_limb_type>(d)) || (x < static_cast<signed_double_limb_type>(a)))
+            break;
+         n1 = x - static_cast<signed_double_limb_type>(a);
+         d1 = y + static_cast<signed_double_limb_type>(c);
+         n2 = x + static_cast<signed_double_limb_type>(b);
+         d2 = y - static_cast<signed_double_limb_type>(d);
+      }
+      else
+      {
+         if ((y <= static_cast<signed_double_limb_type>(c)) || (x < static_cast<signed_double_limb_type>(b)))
+            break;
+         n1 = x + static_cast<signed_double_limb_type>(a);
+         d1 = y - static_cast<signed_double_limb_type>(c);
+         n2 = x - static_cast<signed_double_limb_type>(b);
+         d2 = y + static_cast<signed_double_limb_type>(d);
+      }
+      double_limb_type q = static_cast<double_limb_type>(n1) / static_cast<double_limb_type>(d1);
+      if ((q > CppInt::max_limb_value) || !gcd_check_quotient(q, static_cast<double_limb_type>(n2), static_cast<double_limb_type>(d2)))
+         break;
+      double_limb_type nc = a + q * c;
+      double_limb_type nd = b + q * d;
+      if ((nc > CppInt::max_limb_value) || (nd > CppInt::max_limb_value))
+         break;
+      a = c;
+      b = d;
+      c = nc;
+      d = nd;
+      odd = !odd;
+      signed_double_limb_type t = x - static_cast<signed_double_limb_type>(q) * y;
+      x = y;
+      y = t;
+   }
+   m.a   = static_cast<limb_type>(a);
+   m.b   = static_cast<limb_type>(b);
+   m.c   = static_cast<limb_type>(c);
+   m.d   = static_cast<limb_type>(d);
+   m.odd = odd;
+   return b != 0;
+}
+//
+// Applies the cofactors in m to u >= v, the results are the next remainders in the
+// Euclidean sequence so are non-negative and no larger than u:
+//
+template <class CppInt>
+void lehmer_update(CppInt& u, CppInt& v, const lehmer_matrix& m)
+{
+   unsigned n  = u.size();
+   unsigned vs = v.size();
+   v.resize(n, n);
+   std::memset(v.limbs() + vs, 0, (n - vs) * sizeof(limb_type));
+   limb_type* pu = u.limbs();
+   limb_type* pv = v.limbs();
+   //
+   // u becomes p1 * x - q1 * y and v becomes p2 * y - q2 * x, where x is u and y is v,
+   // or the other way around when m.odd is set:
+   //
+   limb_type        p1 = m.odd ? m.b : m.a;
+   limb_type        q1 = m.odd ? m.a : m.b;
+   limb_type        p2 = m.odd ? m.c : m.d;
+   limb_type        q2 = m.odd ? m.d : m.c;
+   double_limb_type cp1(0), cq1(0), cp2(0), cq2(0), t;
+   limb_type        borrow1(0), borrow2(0);
+   for (unsigned i = 0; i < n; ++i)
+   {
+      limb_type x = m.odd ? pv[i] : pu[i];
+      limb_type y = m.odd ? pu[i] : pv[i];
+      cp1 += static_cast<double_limb_type>(p1) * x;
+      cq1 += static_cast<double_limb_type>(q1) * y;
+      cp2 += static_cast<double_limb_type>(p2) * y;
+      cq2 += static_cast<double_limb_type>(q2) * x;
+      t       = static_cast<double_limb_type>(static_cast<limb_type>(cp1)) - static_cast<limb_type>(cq1) - borrow1;
+      pu[i]   = static_cast<limb_type>(t);
+      borrow1 = static_cast<limb_type>(t >> CppInt::limb_bits) ? 1 : 0;
+      t       = static_cast<double_limb_type>(static_cast<limb_type>(cp2)) - static_cast<limb_type>(cq2) - borrow2;
+      pv[i]   = static_cast<limb_type>(t);
+      borrow2 = static_cast<limb_type>(t >> CppInt::limb_bits) ? 1 : 0;
+      cp1 >>= CppInt::limb_bits;
+      cq1 >>= CppInt::limb_bits;
+      cp2 >>= CppInt::limb_bits;
+      cq2 >>= CppInt::limb_bits;
+   }
+   BOOST_ASSERT((cp1 == cq1 + borrow1) && (cp2 == cq2 + borrow2));
+   u.normalize();
+   v.normalize();
+}
+//
+// One step of Euclid's algorithm: (u, v) becomes (v, u mod v):
+//
+template <class CppInt>
+inline void gcd_division_step(CppInt& u, CppInt& v)
+{
+   eval_modulus(u, u, v);
+   u.swap(v);
+}
+//
+// Applies the run of Euclid steps in m to the cofactors (r0, r1) of u and v, x, y and z are
+// workspace:
+//
+template <class CppInt>
+void gcd_cofactor_update(CppInt& r0, CppInt& r1, const lehmer_matrix& m, CppInt& x, CppInt& y, CppInt& z)
+{
+   eval_multiply(x, m.odd ? r1 : r0, m.odd ? m.b : m.a);
+   eval_multiply(z, m.odd ? r0 : r1, m.odd ? m.a : m.b);
+   eval_subtract(x, z);
+   eval_multiply(y, m.odd ? r0 : r1, m.odd ? m.c : m.d);
+   eval_multiply(z, m.odd ? r1 : r0, m.odd ? m.d : m.c);
+   eval_subtract(y, z);
+   r0.swap(x);
+   r1.swap(y);
+}
+//
+// Applies the Euclid step with quotient q to the cofactors (r0, r1), z is workspace:
+//
+template <class CppInt>
+void gcd_cofactor_update(CppInt& r0, CppInt& r1, const CppInt& q, CppInt& z)
+{
+   eval_multiply(z, q, r1);
+   eval_subtract(r0, z);
+   r0.swap(r1);
+}
+//
+// The half-gcd algorithm: see Niels Moller, "On Schonhage's algorithm and subquadratic integer
+// gcd computation", Math. Comp. 77 (2008).  A run of Euclid steps on (a, b) is represented by
+// the matrix which takes (a, b) to the pair of remainders reached, and a run that roughly halves
+// the size of a can be found by recursing on the leading half of a and b twice over.
+//
+// Any matrix with determinant +-1 preserves the gcd, so even if the steps found from the leading
+// limbs are not exactly those of the full values, all we lose is a little progress.
+//
+template <class CppInt>
+struct hgcd_matrix
+{
+   CppInt m[2][2];
+
+   void set_identity()
+   {
+      m[0][0] = m[1][1] = static_cast<limb_type>(1u);
+      m[0][1] = m[1][0] = static_cast<limb_type>(0u);
+   }
+   void swap(hgcd_matrix& o)
+   {
+      for (unsigned i = 0; i < 2; ++i)
+         for (unsigned j = 0; j < 2; ++j)
+            m[i][j].swap(o.m[i][j]);
+   }
+};
+//
+// Sets (a, b) to t * (a, b), where t has already reduced the parts ah, bh of a and b above
+// limb p: only the low p limbs need multiplying out, ah and bh are destroyed.  Then restores a >= b >= 0 by adjusting
+// the signs and order of the rows of t as required:
+//
+template <class CppInt>
+void hgcd_apply(hgcd_matrix<CppInt>& t, CppInt& a, CppInt& b, CppInt& ah, CppInt& bh, unsigned p)
+{
+   const CppInt al(a.limbs(), 0, (std::min)(p, a.size())), bl(b.limbs(), 0, (std::min)(p, b.size()));
+   CppInt       x, y, z;
+   eval_multiply(x, t.m[0][0], al);
+   eval_multiply(z, t.m[0][1], bl);
+   eval_add(x, z);
+   eval_multiply(y, t.m[1][0], al);
+   eval_multiply(z, t.m[1][1], bl);
+   eval_add(y, z);
+   eval_left_shift(ah, p * CppInt::limb_bits);
+   eval_add(x, ah);
+   eval_left_shift(bh, p * CppInt::limb_bits);
+   eval_add(y, bh);
+   a.swap(x);
+   b.swap(y);
+   for (unsigned i = 0; i < 2; ++i)
+   {
+      CppInt& r = i ? b : a;
+      if (r.sign())
+      {
+         r.negate();
+         t.m[i][0].negate();
+         t.m[i][1].negate();
+      }
+   }
+   if (a.compare(b) < 0)
+   {
+      a.swap(b);
+      t.m[0][0].swap(t.m[1][0]);
+      t.m[0][1].swap(t.m[1][1]);
+   }
+}
+//
+// Sets the column vector (r0, r1) to t * (r0, r1), and then the matrix r to t * r:
+//
+template <class CppInt>
+void hgcd_multiply(CppInt& r0, CppInt& r1, const hgcd_matrix<CppInt>& t, CppInt& x, CppInt& y, CppInt& z)
+{
+   eval_multiply(x, t.m[0][0], r0);
+   eval_multiply(z, t.m[0][1], r1);
+   eval_add(x, z);
+   eval_multiply(y, t.m[1][0], r0);
+   eval_multiply(z, t.m[1][1], r1);
+   eval_add(y, z);
+   r0.swap(x);
+   r1.swap(y);
+}
+template <class CppInt>
+void hgcd_multiply(hgcd_matrix<CppInt>& r, const hgcd_matrix<CppInt>& t)
+{
+   CppInt x, y, z;
+   for (unsigned j = 0; j < 2; ++j)
+      hgcd_multiply(r.m[0][j], r.m[1][j], t, x, y, z);
+}
+//
+// A single Lehmer step, or a division step if that is not possible, on a >= b > 0,
+// with the step accumulated into *pt if that is not null:
+//
+template <class CppInt>
+void hgcd_step(CppInt& a, CppInt& b, hgcd_matrix<CppInt>* pt)
+{
+   lehmer_matrix lm;
+   if ((a.size() <= b.size() + 1) && lehmer_cofactors(a, b, lm))
+   {
+      lehmer_update(a, b, lm);
+      if (pt)
+      {
+         CppInt x, y, z;
+         for (unsigned j = 0; j < 2; ++j)
+            gcd_cofactor_update(pt->m[0][j], pt->m[1][j], lm, x, y, z);
+      }
+   }
+   else if (pt)
+   {
+      CppInt q, r;
+      divide_unsigned_helper(&q, a, b, r);
+      a.swap(b);
+      b.swap(r);
+      for (unsigned j = 0; j < 2; ++j)
+         gcd_cofactor_update(pt->m[0][j], pt->m[1][j], q, r);
+   }
+   else
+      gcd_division_step(a, b);
+}
+
+template <class CppInt>
+void hgcd(CppInt& a, CppInt& b, hgcd_matrix<CppInt>* pt);
+//
+// Finds the matrix t which reduces the limbs of a and b from p upwards, and applies it to
+// a and b:
+//
+template <class CppInt>
+void hgcd_high_part(CppInt& a, CppInt& b, unsigned p, hgcd_matrix<CppInt>& t)
+{
+   const CppInt a_alias(a.limbs(), p, a.size() - p);
+   CppInt       ah, bh;
+   ah = a_alias;
+   if (b.size() > p)
+   {
+      const CppInt b_alias(b.limbs(), p, b.size() - p);
+      bh = b_alias;
+   }
+   hgcd(ah, bh, &t);
+   hgcd_apply(t, a, b, ah, bh, p);
+}
+//
+// Reduces a >= b >= 0 of n limbs until b has no more than n / 2 + 1 limbs.  If pt
+// is not null then the matrix taking the old (a, b) to the new is stored in *pt:
+//
+template <class CppInt>
+void hgcd(CppInt& a, CppInt& b, hgcd_matrix<CppInt>* pt)
+{
+   if (pt)
+      pt->set_identity();
+   unsigned n = a.size();
+   unsigned s = n / 2 + 1;
+   if (b.size() <= s)
+      return;
+   if (n >= hgcd_cutoff)
+   {
+      //
+      // The leading n - p limbs determine about the first (n - p) / 2 limbs worth of
+      // steps, leaving a and b with about 3n/4 limbs:
+      //
+      hgcd_matrix<CppInt> t;
+      hgcd_high_part(a, b, n / 2, t);
+      if (pt)
+         pt->swap(t);
+      if (b.size() > s)
+         hgcd_step(a, b, pt);
+      //
+      // Then the same again on the leading 2 (a.size() - s) limbs takes us down to about s:
+      //
+      if (b.size() > s + 2)
+      {
+         hgcd_high_part(a, b, 2 * s - a.size() + 1, t);
+         if (pt)
+            hgcd_multiply(*pt, t);
+      }
+   }
+   while (b.size() > s)
+      hgcd_step(a, b, pt);
+}
+//
+// Reduces u >= v > 0 with steps which preserve the gcd until v has fewer than
+// hgcd_cutoff limbs:
+//
+template <class CppInt>
+void gcd_hgcd_reduce(CppInt& u, CppInt& v)
+{
+   while (v.size() >= hgcd_cutoff)
+   {
+      if (u.size() > v.size() + 1)
+         gcd_division_step(u, v);
+      else
+      {
+         unsigned n = v.size();
+         hgcd(u, v, static_cast<hgcd_matrix<CppInt>*>(0));
+         if (v.size() >= n)
+            gcd_division_step(u, v);
+      }
+   }
+}
+//
+// Sets u to gcd(u, v) for u, v > 0, by the half-gcd algorithm for large values and then
+// Lehmer's algorithm, the half-gcd work is done in a variable precision type as the
+// matrix products may be wider than u:
+//
+template <class CppInt>
+void eval_gcd_lehmer(CppInt& u, CppInt& v)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   if (u.compare(v) < 0)
+      u.swap(v);
+   if (v.size() >= hgcd_cutoff)
+   {
+      const variable_precision_type u_alias(u.limbs(), 0, u.size()), v_alias(v.limbs(), 0, v.size());
+      variable_precision_type       x, y;
+      x = u_alias;
+      y = v_alias;
+      gcd_hgcd_reduce(x, y);
+      u = x;
+      v = y;
+   }
+   while (v.size() > 1)
+   {
+      lehmer_matrix m;
+      if ((u.size() <= v.size() + 1) && lehmer_cofactors(u, v, m))
+         lehmer_update(u, v, m);
+      else
+         gcd_division_step(u, v);
+   }
+   limb_type i = *v.limbs();
+   if (i)
+      u = eval_gcd(i, static_cast<limb_type>(u.size() > 1 ? eval_integer_modulus(u, i) : *u.limbs()));
+}
 
 template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
 inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
@@ -543,6 +976,16 @@ eval_gcd(
       result = u;
       return;
    }
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(u.size()) && ((std::max)(u.size(), v.size()) >= lehmer_gcd_cutoff))
+#else
+   if ((std::max)(u.size(), v.size()) >= lehmer_gcd_cutoff)
+#endif
+   {
+      eval_gcd_lehmer(u, v);
+      result = u;
+      return;
+   }
 
    /* Let shift := lg K, where K is the greatest power of 2
    dividing both u and v. */
@@ -619,6 +1062,192 @@ eval_lcm(cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& r
    result.normalize(); // result may overflow the specified number of bits
 }
 
+//
+// Extended Euclid on single limbs u >= v > 0: returns the gcd and sets m to the cofactors of
+// the complete run, in the same form as lehmer_cofactors:
+//
+inline limb_type gcd_limb_cofactors(limb_type u, limb_type v, lehmer_matrix& m)
+{
+   limb_type a(1), b(0), c(0), d(1);
+   bool      odd = false;
+   while (v)
+   {
+      limb_type q = u / v;
+      limb_type t = u - q * v;
+      u           = v;
+      v           = t;
+      t           = a + q * c;
+      a           = c;
+      c           = t;
+      t           = b + q * d;
+      b           = d;
+      d           = t;
+      odd         = !odd;
+   }
+   m.a   = a;
+   m.b   = b;
+   m.c   = c;
+   m.d   = d;
+   m.odd = odd;
+   return u;
+}
+//
+// Extended gcd of u >= v >= 0: on entry (s0, s1) are the cofactors giving u and v in terms
+// of whatever quantity the caller is interested in, on exit u is the gcd and s0 its cofactor.
+// Same structure as eval_gcd_lehmer, except that we have to go all the way down to zero, and
+// the quotients are needed to update the cofactors:
+//
+template <class CppInt>
+void eval_gcdext_lehmer(CppInt& u, CppInt& v, CppInt& s0, CppInt& s1)
+{
+   using default_ops::eval_is_zero;
+
+   CppInt        q, r, x, y, z;
+   lehmer_matrix m;
+   while (v.size() >= hgcd_cutoff)
+   {
+      unsigned n = v.size();
+      if (u.size() <= n + 1)
+      {
+         hgcd_matrix<CppInt> t;
+         hgcd(u, v, &t);
+         hgcd_multiply(s0, s1, t, x, y, z);
+      }
+      if (v.size() >= n)
+      {
+         divide_unsigned_helper(&q, u, v, r);
+         u.swap(v);
+         v.swap(r);
+         gcd_cofactor_update(s0, s1, q, z);
+      }
+   }
+   while (!eval_is_zero(v))
+   {
+      if ((u.size() == 1) && (v.size() == 1))
+      {
+         u = gcd_limb_cofactors(*u.limbs(), *v.limbs(), m);
+         gcd_cofactor_update(s0, s1, m, x, y, z);
+         break;
+      }
+      if ((v.size() > 1) && (u.size() <= v.size() + 1) && lehmer_cofactors(u, v, m))
+      {
+         lehmer_update(u, v, m);
+         gcd_cofactor_update(s0, s1, m, x, y, z);
+      }
+      else
+      {
+         divide_unsigned_helper(&q, u, v, r);
+         u.swap(v);
+         v.swap(r);
+         gcd_cofactor_update(s0, s1, q, z);
+      }
+   }
+}
+//
+// Sets g = gcd(a, b) and s, t such that a * s + b * t = g.  Only the cofactor of a is tracked,
+// t is then found with a single division at the end:
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_gcdext(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       g,
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       s,
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       t,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& b)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   using default_ops::eval_is_zero;
+
+   const variable_precision_type x(a.limbs(), 0, a.size()), y(b.limbs(), 0, b.size());
+   variable_precision_type       u, v, s0, s1;
+   u = x;
+   v = y;
+   //
+   // Track the cofactor of x, whichever way round u and v are:
+   //
+   if (u.compare(v) >= 0)
+      s0 = static_cast<limb_type>(1u);
+   else
+   {
+      u.swap(v);
+      s1 = static_cast<limb_type>(1u);
+   }
+   eval_gcdext_lehmer(u, v, s0, s1);
+   if (eval_is_zero(u))
+      s0 = static_cast<limb_type>(0u);
+   if (eval_is_zero(y))
+      s1 = static_cast<limb_type>(0u);
+   else
+   {
+      //
+      // The half-gcd steps are not exactly those of Euclid's algorithm, so reduce s0 to the
+      // cofactor Euclid would give, with |s0| <= y / 2g:
+      //
+      eval_divide(s1, y, u);
+      eval_modulus(v, s0, s1);
+      s0.swap(v);
+      v = s0;
+      eval_left_shift(v, 1u);
+      if (v.compare_unsigned(s1) > 0)
+      {
+         if (s0.sign())
+            eval_add(s0, s1);
+         else
+            eval_subtract(s0, s1);
+      }
+      eval_multiply(v, s0, x);
+      v.negate();
+      eval_add(v, u);
+      eval_divide(s1, v, y);
+   }
+   if (a.sign())
+      s0.negate();
+   if (b.sign())
+      s1.negate();
+   g = u;
+   s = s0;
+   t = s1;
+}
+//
+// Sets result to the inverse of a modulo m in [0, |m|) and returns true, or returns false if there
+// is no such inverse:
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value, bool>::type
+eval_invert_mod(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& m)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   using default_ops::eval_is_zero;
+
+   const variable_precision_type x(a.limbs(), 0, a.size()), y(m.limbs(), 0, m.size());
+   variable_precision_type       u, v, s0, s1;
+   if (eval_is_zero(y))
+      return false;
+   //
+   // v = a mod |m|, then track the cofactor of v:
+   //
+   eval_modulus(v, x, y);
+   if (a.sign() && !eval_is_zero(v))
+   {
+      v.negate();
+      eval_add(v, y);
+   }
+   u  = y;
+   s1 = static_cast<limb_type>(1u);
+   eval_gcdext_lehmer(u, v, s0, s1);
+   if ((u.size() != 1) || (*u.limbs() != 1))
+      return false;
+   if (s0.sign())
+      eval_add(s0, y);
+   result = s0;
+   return true;
+}
 inline void conversion_overflow(const mpl::int_<checked>&)
 {
    BOOST_THROW_EXCEPTION(std::overflow_error("Overflow in conversion to narrower type"));
@@ -0,0 +1,447 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Montgomery multiplication and modular exponentiation for cpp_int.  The
+// multiply-reduce kernel is the CIOS method from "Analyzing and Comparing
+// Montgomery Multiplication Algorithms", C. K. Koc, T. Acar and B. S. Kaliski,
+// IEEE Micro, 1996.
+//
+#ifndef BOOST_MP_CPP_INT_MONTGOMERY_HPP
+#define BOOST_MP_CPP_INT_MONTGOMERY_HPP
+
+#include <vector>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// Minimum number of limbs in an odd modulus for eval_powm to switch from
+// square and multiply with full divisions to Montgomery multiplication:
+//
+#ifdef BOOST_MP_MONTGOMERY_POWM_CUTOFF
+const size_t montgomery_powm_cutoff = BOOST_MP_MONTGOMERY_POWM_CUTOFF;
+#else
+const size_t montgomery_powm_cutoff = 2;
+#endif
+//
+// Minimum number of limbs in the modulus for Montgomery multiplication to use a full
+// (subquadratic) multiplication followed by a separate reduction, rather than the
+// interleaved CIOS kernel:
+//
+#ifdef BOOST_MP_MONTGOMERY_REDC_CUTOFF
+const size_t montgomery_redc_cutoff = BOOST_MP_MONTGOMERY_REDC_CUTOFF;
+#else
+const size_t montgomery_redc_cutoff = 80;
+#endif
+//
+// Returns -1/n mod B for odd n.  n is its own inverse to 3 bits, and each
+// Newton step doubles the number of correct bits:
+//
+inline limb_type montgomery_inverse_limb(limb_type n)
+{
+   BOOST_ASSERT(n & 1u);
+   limb_type x = n;
+   for (unsigned bits = 3; bits < sizeof(limb_type) * CHAR_BIT; bits *= 2)
+      x *= static_cast<limb_type>(2u) - n * x;
+   return static_cast<limb_type>(0u) - x;
+}
+//
+// Subtracts n[0, s) from r[0, s) when r[0, s] >= n, r[s] is the overflow limb:
+//
+inline void montgomery_final_subtract(limb_type* r, limb_type overflow, const limb_type* n, unsigned s)
+{
+   if (!overflow)
+   {
+      unsigned i = s;
+      while (i-- > 0)
+      {
+         if (r[i] != n[i])
+         {
+            if (r[i] < n[i])
+               return;
+            break;
+         }
+      }
+   }
+   limb_type borrow = 0;
+   for (unsigned i = 0; i < s; ++i)
+   {
+      limb_type l = r[i];
+      limb_type d = l - n[i] - borrow;
+      borrow      = (l < n[i]) || ((l == n[i]) && borrow);
+      r[i]        = d;
+   }
+}
+//
+// The CIOS loop: sets r[0, s] = a * b / B^s, congruent to the Montgomery product
+// modulo n and less than 2n, where a and b have as, bs <= s limbs and a * b < n * B^s.
+// r needs room for s + 2 limbs and must not overlap a or b.  Nothing here depends on
+// the values of a or b, only on their sizes:
+//
+inline void montgomery_cios_limbs(limb_type* r, const limb_type* a, unsigned as, const limb_type* b, unsigned bs, const limb_type* n, unsigned s, limb_type n_inv)
+{
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   std::memset(r, 0, (s + 2) * sizeof(limb_type));
+   for (unsigned i = 0; i < s; ++i)
+   {
+      double_limb_type carry = 0;
+      if (i < as)
+      {
+         limb_type ai = a[i];
+         unsigned  j  = 0;
+         for (; j < bs; ++j)
+         {
+            carry += static_cast<double_limb_type>(ai) * b[j] + r[j];
+            r[j] = static_cast<limb_type>(carry);
+            carry >>= limb_bits;
+         }
+         for (; j <= s; ++j)
+         {
+            carry += r[j];
+            r[j] = static_cast<limb_type>(carry);
+            carry >>= limb_bits;
+         }
+         r[s + 1] = static_cast<limb_type>(carry);
+      }
+      limb_type m = r[0] * n_inv;
+      carry       = (static_cast<double_limb_type>(m) * n[0] + r[0]) >> limb_bits;
+      for (unsigned j = 1; j < s; ++j)
+      {
+         carry += static_cast<double_limb_type>(m) * n[j] + r[j];
+         r[j - 1] = static_cast<limb_type>(carry);
+         carry >>= limb_bits;
+      }
+      carry += r[s];
+      r[s - 1] = static_cast<limb_type>(carry);
+      r[s]     = r[s + 1] + static_cast<limb_type>(carry >> limb_bits);
+      r[s + 1] = 0;
+   }
+}
+//
+// CIOS Montgomery multiplication: sets r[0, s) = a * b / B^s mod n, with the same
+// requirements as above:
+//
+inline void montgomery_multiply_limbs(limb_type* r, const limb_type* a, unsigned as, const limb_type* b, unsigned bs, const limb_type* n, unsigned s, limb_type n_inv)
+{
+   montgomery_cios_limbs(r, a, as, b, bs, n, s, n_inv);
+   montgomery_final_subtract(r, r[s], n, s);
+}
+//
+// Montgomery reduction of t[0, 2s) in place, leaves t / B^s mod n in t[s, 2s) for
+// t < n * B^s.  Used when the product comes from a subquadratic multiplication:
+//
+inline void montgomery_reduce_limbs(limb_type* t, const limb_type* n, unsigned s, limb_type n_inv)
+{
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   limb_type      overflow  = 0;
+   for (unsigned i = 0; i < s; ++i)
+   {
+      limb_type        m     = t[i] * n_inv;
+      double_limb_type carry = 0;
+      for (unsigned j = 0; j < s; ++j)
+      {
+         carry += static_cast<double_limb_type>(m) * n[j] + t[i + j];
+         t[i + j] = static_cast<limb_type>(carry);
+         carry >>= limb_bits;
+      }
+      for (unsigned k = i + s; carry && (k < 2 * s); ++k)
+      {
+         carry += t[k];
+         t[k] = static_cast<limb_type>(carry);
+         carry >>= limb_bits;
+      }
+      overflow += static_cast<limb_type>(carry);
+   }
+   montgomery_final_subtract(t + s, overflow, n, s);
+}
+
+//
+// Holds an odd modulus n > 0 together with -1/n mod B and R^2 mod n, where
+// R = B^s and s is the number of limbs in n, and performs arithmetic on
+// values in Montgomery form x * R mod n.  Values are fully reduced at all
+// times.  Instances are immutable once constructed, so may be shared between
+// threads:
+//
+class montgomery_context
+{
+ public:
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > value_type;
+
+ private:
+   value_type m_modulus, m_r2;
+   limb_type  m_inverse;
+
+ public:
+   montgomery_context() : m_inverse(0) {}
+   template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+   explicit montgomery_context(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& n)
+   {
+      const value_type n_t(n.limbs(), 0, n.size());
+      BOOST_ASSERT(*n_t.limbs() & 1u);
+      m_modulus = n_t;
+      m_inverse = montgomery_inverse_limb(*m_modulus.limbs());
+      //
+      // R^2 mod n is a one off cost, so a plain division will do:
+      //
+      unsigned   s = m_modulus.size();
+      value_type p;
+      p.resize(2 * s + 1, 2 * s + 1);
+      std::memset(p.limbs(), 0, 2 * s * sizeof(limb_type));
+      p.limbs()[2 * s] = 1;
+      eval_modulus(m_r2, p, m_modulus);
+   }
+
+   const value_type& modulus() const { return m_modulus; }
+   unsigned          size() const { return m_modulus.size(); }
+
+   //
+   // Conversions to and from Montgomery form, a must be less than n:
+   //
+   void to_montgomery(value_type& r, const value_type& a) const
+   {
+      multiply(r, a, m_r2);
+   }
+   void from_montgomery(value_type& r, const value_type& a) const
+   {
+      static const limb_type one = 1u;
+      const value_type       one_t(&one, 0, 1);
+      multiply(r, a, one_t);
+   }
+   //
+   // Sets r = a * b / R mod n:
+   //
+   void multiply(value_type& r, const value_type& a, const value_type& b) const
+   {
+      if ((&r == &a) || (&r == &b))
+      {
+         value_type t;
+         multiply(t, a, b);
+         r.swap(t);
+         return;
+      }
+      unsigned s = m_modulus.size();
+      if (s < montgomery_redc_cutoff)
+      {
+         r.resize(s + 2, s + 2);
+         montgomery_multiply_limbs(r.limbs(), a.limbs(), a.size(), b.limbs(), b.size(), m_modulus.limbs(), s, m_inverse);
+         finish(r, r.limbs(), s);
+      }
+      else
+      {
+         eval_multiply(r, a, b);
+         reduce(r);
+      }
+   }
+   void square(value_type& r, const value_type& a) const
+   {
+      if (&r == &a)
+      {
+         value_type t;
+         square(t, a);
+         r.swap(t);
+         return;
+      }
+      unsigned s = m_modulus.size();
+      if (s < montgomery_redc_cutoff)
+      {
+         r.resize(s + 2, s + 2);
+         montgomery_multiply_limbs(r.limbs(), a.limbs(), a.size(), a.limbs(), a.size(), m_modulus.limbs(), s, m_inverse);
+         finish(r, r.limbs(), s);
+      }
+      else
+      {
+         eval_square(r, a);
+         reduce(r);
+      }
+   }
+   //
+   // Sets r = a^p mod n by left to right sliding window exponentiation, where a is less
+   // than n and in normal (not Montgomery) form, as is the result:
+   //
+   void powm(value_type& r, const value_type& a, const limb_type* p, unsigned ps) const
+   {
+      const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+      while (ps && !p[ps - 1])
+         --ps;
+      if (!ps)
+      {
+         r = static_cast<limb_type>((m_modulus.size() > 1) || (*m_modulus.limbs() > 1) ? 1u : 0u);
+         return;
+      }
+      unsigned bits = (ps - 1) * limb_bits + boost::multiprecision::detail::find_msb(p[ps - 1]) + 1;
+      unsigned w    = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 1;
+      //
+      // Odd powers a, a^3, ..., a^(2^w - 1):
+      //
+      std::vector<value_type> table(static_cast<std::size_t>(1u) << (w - 1));
+      to_montgomery(table[0], a);
+      if (w > 1)
+      {
+         value_type a2;
+         square(a2, table[0]);
+         for (std::size_t k = 1; k < table.size(); ++k)
+            multiply(table[k], table[k - 1], a2);
+      }
+      value_type x, t;
+      bool       started = false;
+      int        i       = static_cast<int>(bits) - 1;
+      while (i >= 0)
+      {
+         if (!((p[i / limb_bits] >> (i % limb_bits)) & 1u))
+         {
+            square(t, x);
+            x.swap(t);
+            --i;
+            continue;
+         }
+         int l = (std::max)(i - static_cast<int>(w) + 1, 0);
+         while (!((p[l / limb_bits] >> (l % limb_bits)) & 1u))
+            ++l;
+         unsigned value = 0;
+         for (int k = i; k >= l; --k)
+            value = (value << 1) | static_cast<unsigned>((p[k / limb_bits] >> (k % limb_bits)) & 1u);
+         if (started)
+         {
+            for (int k = i; k >= l; --k)
+            {
+               square(t, x);
+               x.swap(t);
+            }
+            multiply(t, x, table[value >> 1]);
+            x.swap(t);
+         }
+         else
+         {
+            x       = table[value >> 1];
+            started = true;
+         }
+         i = l - 1;
+      }
+      from_montgomery(r, x);
+   }
+
+ private:
+   //
+   // Sets r to the s limb result at p, which may point into r's own storage:
+   //
+   static void finish(value_type& r, const limb_type* p, unsigned s)
+   {
+      if (p != r.limbs())
+         std::memmove(r.limbs(), p, s * sizeof(limb_type));
+      r.resize(s, s);
+      r.normalize();
+      r.sign(false);
+   }
+   void reduce(value_type& r) const
+   {
+      unsigned s  = m_modulus.size();
+      unsigned rs = r.size();
+      r.resize(2 * s, 2 * s);
+      std::memset(r.limbs() + rs, 0, (2 * s - rs) * sizeof(limb_type));
+      montgomery_reduce_limbs(r.limbs(), m_modulus.limbs(), s, m_inverse);
+      finish(r, r.limbs() + s, s);
+   }
+};
+
+//
+// The limb level reducer for modular_adaptor<cpp_int_backend<> >, see modular_adaptor.hpp:
+//
+template <class Backend>
+class montgomery_reducer;
+
+template <>
+class montgomery_reducer<montgomery_context::value_type>
+{
+   typedef montgomery_context::value_type value_type;
+
+   montgomery_context m_context;
+
+ public:
+   montgomery_reducer() {}
+   explicit montgomery_reducer(const value_type& n) : m_context(n) {}
+
+   void to_montgomery(value_type& r, const value_type& a) const { m_context.to_montgomery(r, a); }
+   void from_montgomery(value_type& r, const value_type& a) const { m_context.from_montgomery(r, a); }
+   void multiply(value_type& r, const value_type& a, const value_type& b) const { m_context.multiply(r, a, b); }
+   void square(value_type& r, const value_type& a) const { m_context.square(r, a); }
+};
+
+//
+// Sets result = (a^p) mod c for odd c.  The sign of the result follows a, as for
+// the default square and multiply:
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+void eval_powm_montgomery(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const limb_type*                                                            p,
+    unsigned                                                                    ps,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   typedef montgomery_context::value_type variable_precision_type;
+
+   montgomery_context            ctx(c);
+   const variable_precision_type x(a.limbs(), 0, a.size());
+   variable_precision_type       r;
+   if (x.compare_unsigned(ctx.modulus()) >= 0)
+   {
+      variable_precision_type t;
+      eval_modulus(t, x, ctx.modulus());
+      ctx.powm(r, t, p, ps);
+   }
+   else
+      ctx.powm(r, x, p, ps);
+   if (a.sign() && (*p & 1u))
+      r.negate();
+   result = r;
+}
+
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_powm(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(c.size()) && (c.size() >= montgomery_powm_cutoff) && (*c.limbs() & 1u) && !p.sign())
+#else
+   if ((c.size() >= montgomery_powm_cutoff) && (*c.limbs() & 1u) && !p.sign())
+#endif
+   {
+      eval_powm_montgomery(result, a, p.limbs(), p.size(), c);
+      return;
+   }
+   default_ops::eval_powm(result, a, p, c);
+}
+
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, class Integer>
+inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && is_unsigned<Integer>::value>::type
+eval_powm(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    Integer                                                                     b,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(c.size()) && (c.size() >= montgomery_powm_cutoff) && (*c.limbs() & 1u))
+#else
+   if ((c.size() >= montgomery_powm_cutoff) && (*c.limbs() & 1u))
+#endif
+   {
+      typedef montgomery_context::value_type                                                variable_precision_type;
+      typedef typename boost::multiprecision::detail::canonical<Integer, variable_precision_type>::type ui_type;
+
+      variable_precision_type p;
+      p = static_cast<ui_type>(b);
+      eval_powm_montgomery(result, a, p.limbs(), p.size(), c);
+      return;
+   }
+   default_ops::eval_powm(result, a, b, c);
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
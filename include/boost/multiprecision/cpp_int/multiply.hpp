@@ -11,6 +11,7 @@
 #define BOOST_MP_CPP_INT_MUL_HPP
 
 #include <boost/multiprecision/integer.hpp>
+#include <boost/multiprecision/cpp_int/ntt.hpp>
 
 namespace boost { namespace multiprecision { namespace backends {
 
@@ -85,6 +86,48 @@ const size_t karatsuba_cutoff = BOOST_MP_KARATSUBA_CUTOFF;
 const size_t karatsuba_cutoff = 40;
 #endif
 //
+// Minimum number of limbs required for Toom-Cook 3-way and 4-way splitting to be worthwhile,
+// both arguments must be at least this large, and of roughly the same size:
+//
+#ifdef BOOST_MP_TOOM3_CUTOFF
+const size_t toom3_cutoff = BOOST_MP_TOOM3_CUTOFF;
+#else
+const size_t toom3_cutoff = 100;
+#endif
+#ifdef BOOST_MP_TOOM4_CUTOFF
+const size_t toom4_cutoff = BOOST_MP_TOOM4_CUTOFF;
+#else
+const size_t toom4_cutoff = 300;
+#endif
+//
+// Minimum number of limbs in the smaller argument for a number theoretic
+// transform to beat Toom-Cook:
+//
+#ifdef BOOST_MP_NTT_CUTOFF
+const size_t ntt_cutoff = BOOST_MP_NTT_CUTOFF;
+#else
+const size_t ntt_cutoff = 12000;
+#endif
+
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom3(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom4(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_unbalanced(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+//
 // Core (recursive) Karatsuba multiplication, all the storage required is allocated upfront and 
 // passed down the stack in this routine.  Note that all the cpp_int_backend's must be the same type
 // and full variable precision.  Karatsuba really doesn't play nice with fixed-size integers.  If necessary
@@ -103,7 +146,8 @@ inline void multiply_karatsuba(
    unsigned bs = b.size();
    //
    // Termination condition: if either argument is smaller than karatsuba_cutoff
-   // then schoolboy multiplication will be faster:
+   // then schoolboy multiplication will be faster (eval_multiply will pick up
+   // squaring if a and b are the same object):
    //
    if ((as < karatsuba_cutoff) || (bs < karatsuba_cutoff))
    {
@@ -111,9 +155,47 @@ inline void multiply_karatsuba(
       return;
    }
    //
+   // When squaring, a and b are the same object: all the routines below then
+   // evaluate only one operand, and recurse with both arguments aliasing the
+   // same temporary so that squaring is used all the way down:
+   //
+   bool square = &a == &b;
+   //
+   // For very large arguments use a number theoretic transform, if one argument
+   // is at least twice the length of the other then slice it into pieces,
+   // and for large arguments of similar size, splitting into 3 or 4 parts is more
+   // efficient.  We require that the smaller argument has a non-zero top part
+   // after splitting, otherwise plain Karatsuba with padding is the better choice:
+   //
+   unsigned s = (std::max)(as, bs);
+   unsigned m = (std::min)(as, bs);
+   if ((m >= ntt_cutoff) && ntt_detail::can_multiply<limb_type>(as, bs))
+   {
+      result.resize(as + bs, as + bs);
+      ntt_detail::multiply(result.limbs(), a.limbs(), as, b.limbs(), bs);
+      result.normalize();
+      result.sign(a.sign() != b.sign());
+      return;
+   }
+   if (s >= 2 * m)
+   {
+      multiply_unbalanced(result, a, b, storage);
+      return;
+   }
+   if ((m >= toom4_cutoff) && (m > 3 * ((s + 3) / 4)))
+   {
+      multiply_toom4(result, a, b, storage);
+      return;
+   }
+   if ((m >= toom3_cutoff) && (m > 2 * ((s + 2) / 3)))
+   {
+      multiply_toom3(result, a, b, storage);
+      return;
+   }
+   //
    // Partitioning size: split the larger of a and b into 2 halves
    //
-   unsigned n  = (as > bs ? as : bs) / 2 + 1;
+   unsigned n  = s / 2 + 1;
    //
    // Partition a and b into high and low parts.
    // ie write a, b as a = a_h * 2^n + a_l, b = b_h * 2^n + b_l
@@ -163,7 +245,7 @@ inline void multiply_karatsuba(
    //
    // low part of result is a_l * b_l:
    //
-   multiply_karatsuba(result_low, a_l, b_l, storage);
+   multiply_karatsuba(result_low, a_l, square ? a_l : b_l, storage);
    //
    // We haven't zeroed out memory in result, so set to zero any unused limbs,
    // if a_l and b_l have mostly random bits then nothing happens here, but if
@@ -176,15 +258,20 @@ inline void multiply_karatsuba(
    //
    // Set the high part of result to a_h * b_h:
    //
-   multiply_karatsuba(result_high, a_h, b_h, storage);
+   multiply_karatsuba(result_high, a_h, square ? a_h : b_h, storage);
    for (unsigned i = result_high.size() + 2 * n; i < result.size(); ++i)
       result.limbs()[i] = 0;
    //
    // Now calculate (a_h+a_l)*(b_h+b_l):
    //
    add_unsigned(t2, a_l, a_h);
-   add_unsigned(t3, b_l, b_h);
-   multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   if (square)
+      multiply_karatsuba(t1, t2, t2, storage); // t1 = (a_h+a_l)^2
+   else
+   {
+      add_unsigned(t3, b_l, b_h);
+      multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   }
    //
    // There is now a slight deviation from Karatsuba, we want to subtract
    // a_l*b_l + a_h*b_h from t1, but rather than use an addition and a subtraction
@@ -210,19 +297,379 @@ inline void multiply_karatsuba(
    result.normalize();
 }
 
+//
+// Exact division of the magnitude of a Toom-Cook intermediate by a small constant,
+// the sign is left unchanged.  Powers of 2 are a simple right shift, odd divisors
+// use multiplication by the inverse of d modulo 2^limb_bits (Jebelean's method)
+// which avoids a hardware division per limb:
+//
+template <class CppInt>
+void toom_divide_exact(CppInt& r, limb_type d)
+{
+   typename CppInt::limb_pointer p  = r.limbs();
+   unsigned                      rs = r.size();
+   if ((d & (d - 1)) == 0)
+   {
+      unsigned shift = boost::multiprecision::detail::find_lsb(d);
+      for (unsigned i = 0; i + 1 < rs; ++i)
+         p[i] = (p[i] >> shift) | (p[i + 1] << (CppInt::limb_bits - shift));
+      p[rs - 1] >>= shift;
+   }
+   else
+   {
+      BOOST_ASSERT(d & 1u);
+      limb_type inv = d; // correct to 3 bits, each iteration doubles that:
+      for (unsigned bits = 3; bits < CppInt::limb_bits; bits *= 2)
+         inv *= 2 - d * inv;
+      limb_type borrow = 0;
+      for (unsigned i = 0; i < rs; ++i)
+      {
+         limb_type c = p[i] < borrow ? 1 : 0;
+         p[i]        = (p[i] - borrow) * inv;
+         borrow      = static_cast<limb_type>((static_cast<double_limb_type>(p[i]) * d) >> CppInt::limb_bits) + c;
+      }
+      BOOST_ASSERT(borrow == 0);
+   }
+   r.normalize();
+   r.sign(r.sign());
+}
+//
+// Toom-Cook 3-way multiplication: split a and b into 3 parts each of n limbs,
+// evaluate at the points 0, 1, -1, -2, and infinity, perform 5 recursive multiplications
+// and then interpolate using Bodrato's sequence.  Intermediate values may be negative, so
+// unlike Karatsuba we use signed arithmetic throughout.  As with Karatsuba all temporaries
+// alias memory in the shared storage:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom3(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   unsigned rs = result.size();
+   unsigned n  = ((std::max)(as, bs) + 2) / 3;
+   BOOST_ASSERT((as > 2 * n) && (bs > 2 * n) && (rs >= as + bs));
+   //
+   // Partition a and b, the top parts are always non-empty:
+   //
+   const cpp_int_type a0(a.limbs(), 0, n), a1(a.limbs(), n, n), a2(a.limbs(), 2 * n, as - 2 * n);
+   const cpp_int_type b0(b.limbs(), 0, n), b1(b.limbs(), n, n), b2(b.limbs(), 2 * n, bs - 2 * n);
+   //
+   // Evaluation, each of these is at most n + 1 limbs:
+   //
+   cpp_int_type p1(storage, n + 2), pm1(storage, n + 2), pm2(storage, n + 2);
+   cpp_int_type q1(storage, n + 2), qm1(storage, n + 2), qm2(storage, n + 2);
+
+   eval_add(p1, a0, a2);
+   eval_subtract(pm1, p1, a1);
+   eval_add(p1, a1);
+   eval_add(pm2, pm1, a2);
+   eval_left_shift(pm2, 1);
+   eval_subtract(pm2, a0);
+
+   bool square = &a == &b;
+   if (!square)
+   {
+      eval_add(q1, b0, b2);
+      eval_subtract(qm1, q1, b1);
+      eval_add(q1, b1);
+      eval_add(qm2, qm1, b2);
+      eval_left_shift(qm2, 1);
+      eval_subtract(qm2, b0);
+   }
+   const cpp_int_type &v1 = square ? p1 : q1, &vm1 = square ? pm1 : qm1, &vm2 = square ? pm2 : qm2;
+   //
+   // Pointwise products, r(0) and r(inf) go directly into the result:
+   //
+   cpp_int_type r1(storage, 2 * n + 4), rm1(storage, 2 * n + 4), rm2(storage, 2 * n + 4);
+   cpp_int_type r0(result.limbs(), 0, 2 * n);
+   cpp_int_type rinf(result.limbs(), 4 * n, rs - 4 * n);
+
+   multiply_karatsuba(r0, a0, square ? a0 : b0, storage);
+   for (unsigned i = r0.size(); i < 4 * n; ++i)
+      result.limbs()[i] = 0;
+   multiply_karatsuba(rinf, a2, square ? a2 : b2, storage);
+   for (unsigned i = rinf.size() + 4 * n; i < rs; ++i)
+      result.limbs()[i] = 0;
+   multiply_karatsuba(r1, p1, v1, storage);
+   multiply_karatsuba(rm1, pm1, vm1, storage);
+   rm1.sign(pm1.sign() != vm1.sign());
+   multiply_karatsuba(rm2, pm2, vm2, storage);
+   rm2.sign(pm2.sign() != vm2.sign());
+   r0.sign(false);
+   rinf.sign(false);
+   r1.sign(false);
+   //
+   // Interpolation, on exit r1, r2 (in rm1) and r3 (in rm2) are the
+   // remaining coefficients and are all non-negative:
+   //
+   eval_subtract(rm2, r1);
+   toom_divide_exact(rm2, 3);
+   eval_subtract(r1, rm1);
+   toom_divide_exact(r1, 2);
+   eval_subtract(rm1, r0);
+   eval_subtract(rm2, rm1);
+   rm2.negate();
+   toom_divide_exact(rm2, 2);
+   eval_add(rm2, rinf);
+   eval_add(rm2, rinf);
+   eval_add(rm1, r1);
+   eval_subtract(rm1, rinf);
+   eval_subtract(r1, rm2);
+   BOOST_ASSERT(!r1.sign() && !rm1.sign() && !rm2.sign());
+   //
+   // Recomposition, as with Karatsuba we add into aliases of the result
+   // rather than shifting:
+   //
+   cpp_int_type result_alias(result.limbs(), n, rs - n);
+   add_unsigned(result_alias, result_alias, r1);
+   cpp_int_type result_alias2(result.limbs(), 2 * n, rs - 2 * n);
+   add_unsigned(result_alias2, result_alias2, rm1);
+   cpp_int_type result_alias3(result.limbs(), 3 * n, rs - 3 * n);
+   add_unsigned(result_alias3, result_alias3, rm2);
+
+   storage.deallocate(p1.capacity() + pm1.capacity() + pm2.capacity() + q1.capacity() + qm1.capacity() + qm2.capacity() + r1.capacity() + rm1.capacity() + rm2.capacity());
+
+   result.normalize();
+}
+//
+// Toom-Cook 4-way multiplication: split into 4 parts each and evaluate at the points
+// 0, 1, -1, 2, -2, 1/2 and infinity (the value at 1/2 is scaled by 8 so that it remains
+// an integer), then perform 7 recursive multiplications and interpolate:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom4(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   unsigned rs = result.size();
+   unsigned n  = ((std::max)(as, bs) + 3) / 4;
+   BOOST_ASSERT((as > 3 * n) && (bs > 3 * n) && (rs >= as + bs));
+
+   const cpp_int_type a0(a.limbs(), 0, n), a1(a.limbs(), n, n), a2(a.limbs(), 2 * n, n), a3(a.limbs(), 3 * n, as - 3 * n);
+   const cpp_int_type b0(b.limbs(), 0, n), b1(b.limbs(), n, n), b2(b.limbs(), 2 * n, n), b3(b.limbs(), 3 * n, bs - 3 * n);
+
+   cpp_int_type t(storage, 2 * n + 6);
+   cpp_int_type p1(storage, n + 2), pm1(storage, n + 2), p2(storage, n + 2), pm2(storage, n + 2), ph(storage, n + 2);
+   cpp_int_type q1(storage, n + 2), qm1(storage, n + 2), q2(storage, n + 2), qm2(storage, n + 2), qh(storage, n + 2);
+   //
+   // Evaluation, each value is less than 15 * 2^(n * limb_bits) in magnitude:
+   //
+   bool                square = &a == &b;
+   const cpp_int_type* parts[2][4] = {{&a0, &a1, &a2, &a3}, {&b0, &b1, &b2, &b3}};
+   cpp_int_type*       values[2][5] = {{&p1, &pm1, &p2, &pm2, &ph}, {&q1, &qm1, &q2, &qm2, &qh}};
+   if (square)
+   {
+      for (unsigned i = 0; i < 4; ++i)
+         parts[1][i] = parts[0][i];
+      for (unsigned i = 0; i < 5; ++i)
+         values[1][i] = values[0][i];
+   }
+   for (unsigned i = 0; i < (square ? 1u : 2u); ++i)
+   {
+      const cpp_int_type &x0 = *parts[i][0], &x1 = *parts[i][1], &x2 = *parts[i][2], &x3 = *parts[i][3];
+      cpp_int_type &      v1 = *values[i][0], &vm1 = *values[i][1], &v2 = *values[i][2], &vm2 = *values[i][3], &vh = *values[i][4];
+      // v(1) and v(-1):
+      eval_add(t, x0, x2);
+      eval_add(vm1, x1, x3);
+      eval_add(v1, t, vm1);
+      eval_subtract(vm1, t, vm1);
+      // v(2) and v(-2):
+      t = x2;
+      eval_left_shift(t, 2);
+      eval_add(t, x0);
+      vm2 = x3;
+      eval_left_shift(vm2, 2);
+      eval_add(vm2, x1);
+      eval_left_shift(vm2, 1);
+      eval_add(v2, t, vm2);
+      eval_subtract(vm2, t, vm2);
+      // 8 * v(1/2):
+      vh = x0;
+      eval_left_shift(vh, 1);
+      eval_add(vh, x1);
+      eval_left_shift(vh, 1);
+      eval_add(vh, x2);
+      eval_left_shift(vh, 1);
+      eval_add(vh, x3);
+   }
+   //
+   // Pointwise products:
+   //
+   cpp_int_type r1(storage, 2 * n + 4), rm1(storage, 2 * n + 4), r2(storage, 2 * n + 4), rm2(storage, 2 * n + 4), rh(storage, 2 * n + 4);
+   cpp_int_type r0(result.limbs(), 0, 2 * n);
+   cpp_int_type rinf(result.limbs(), 6 * n, rs - 6 * n);
+
+   multiply_karatsuba(r0, a0, *parts[1][0], storage);
+   for (unsigned i = r0.size(); i < 6 * n; ++i)
+      result.limbs()[i] = 0;
+   multiply_karatsuba(rinf, a3, *parts[1][3], storage);
+   for (unsigned i = rinf.size() + 6 * n; i < rs; ++i)
+      result.limbs()[i] = 0;
+   multiply_karatsuba(r1, p1, *values[1][0], storage);
+   multiply_karatsuba(rm1, pm1, *values[1][1], storage);
+   rm1.sign(pm1.sign() != values[1][1]->sign());
+   multiply_karatsuba(r2, p2, *values[1][2], storage);
+   multiply_karatsuba(rm2, pm2, *values[1][3], storage);
+   rm2.sign(pm2.sign() != values[1][3]->sign());
+   multiply_karatsuba(rh, ph, *values[1][4], storage);
+   r0.sign(false);
+   rinf.sign(false);
+   r1.sign(false);
+   r2.sign(false);
+   rh.sign(false);
+   //
+   // Interpolation, writing c0...c6 for the coefficients of the result, we have
+   // c0 = r0 and c6 = rinf, and solve for the others as follows:
+   //
+   // Odd and even parts from r(1) and r(-1):
+   // rm1 = (r1 - rm1) / 2 = c1 + c3 + c5,  r1 = r1 - rm1 = c0 + c2 + c4 + c6.
+   rm1.negate();
+   eval_add(rm1, r1);
+   toom_divide_exact(rm1, 2);
+   eval_subtract(r1, rm1);
+   // And from r(2) and r(-2):
+   // rm2 = (r2 - rm2) / 4 = c1 + 4c3 + 16c5, r2 = r2 - 2rm2 = c0 + 4c2 + 16c4 + 64c6.
+   rm2.negate();
+   eval_add(rm2, r2);
+   toom_divide_exact(rm2, 4);
+   eval_subtract(r2, rm2);
+   eval_subtract(r2, rm2);
+   // Even coefficients: r1 = c2 + c4, r2 = c2 + 4c4, hence c4 = (r2 - r1) / 3 and c2 = r1 - c4:
+   eval_subtract(r1, r0);
+   eval_subtract(r1, rinf);
+   eval_subtract(r2, r0);
+   t = rinf;
+   eval_left_shift(t, 6);
+   eval_subtract(r2, t);
+   toom_divide_exact(r2, 4);
+   eval_subtract(r2, r1);
+   toom_divide_exact(r2, 3);
+   eval_subtract(r1, r2);
+   // rh = (rh - 64c0 - 16c2 - 4c4 - c6) / 2 = 16c1 + 4c3 + c5:
+   t = r0;
+   eval_left_shift(t, 6);
+   eval_subtract(rh, t);
+   eval_subtract(rh, rinf);
+   t = r1;
+   eval_left_shift(t, 4);
+   eval_subtract(rh, t);
+   t = r2;
+   eval_left_shift(t, 2);
+   eval_subtract(rh, t);
+   toom_divide_exact(rh, 2);
+   // Odd coefficients:
+   // rm2 = (rm2 - rm1) / 3 = c3 + 5c5, rh = (rh - rm1) / 3 = 5c1 + c3, rh = (rh - rm2) / 5 = c1 - c5:
+   eval_subtract(rm2, rm1);
+   toom_divide_exact(rm2, 3);
+   eval_subtract(rh, rm1);
+   toom_divide_exact(rh, 3);
+   eval_subtract(rh, rm2);
+   toom_divide_exact(rh, 5);
+   // c5 = (rm2 - rm1 + rh) / 3, c1 = rh + c5, c3 = rm1 - c1 - c5:
+   eval_subtract(rm2, rm1);
+   eval_add(rm2, rh);
+   toom_divide_exact(rm2, 3);
+   eval_add(rh, rm2);
+   eval_subtract(rm1, rh);
+   eval_subtract(rm1, rm2);
+   BOOST_ASSERT(!rh.sign() && !r1.sign() && !rm1.sign() && !r2.sign() && !rm2.sign());
+   //
+   // Recomposition:
+   //
+   const cpp_int_type* coefficients[5] = {&rh, &r1, &rm1, &r2, &rm2};
+   for (unsigned i = 0; i < 5; ++i)
+   {
+      cpp_int_type result_alias(result.limbs(), (i + 1) * n, rs - (i + 1) * n);
+      add_unsigned(result_alias, result_alias, *coefficients[i]);
+   }
+
+   storage.deallocate(t.capacity() + 10 * (n + 2) + 5 * (2 * n + 4));
+
+   result.normalize();
+}
+
+//
+// Unbalanced multiplication: when one argument is at least twice the length of the
+// other, Karatsuba (or Toom-Cook) would pad the shorter argument with zeros and
+// waste most of the work.  Instead slice the longer argument into k pieces each
+// roughly the same length as the shorter argument, and accumulate the k balanced
+// products into the result at the appropriate offsets:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_unbalanced(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   const cpp_int_type& x  = a.size() >= b.size() ? a : b; // the long one
+   const cpp_int_type& y  = a.size() >= b.size() ? b : a; // the short one
+   unsigned            xs = x.size();
+   unsigned            ys = y.size();
+   unsigned            rs = result.size();
+   BOOST_ASSERT((xs >= 2 * ys) && (rs >= xs + ys));
+   //
+   // Pieces are all of length chunk, except the last which may be shorter.
+   // Since k >= 2, chunk is at most half the length of x, and the storage
+   // bound in karatsuba_storage_size covers both t and the recursive calls:
+   //
+   unsigned k     = xs / ys;
+   unsigned chunk = (xs + k - 1) / k;
+
+   std::memset(result.limbs(), 0, rs * sizeof(limb_type));
+
+   cpp_int_type t(storage, chunk + ys);
+   for (unsigned offset = 0; offset < xs; offset += chunk)
+   {
+      const cpp_int_type piece(x.limbs(), offset, (std::min)(chunk, xs - offset));
+      t.resize(chunk + ys, chunk + ys); // previous iteration will have normalized t
+      multiply_karatsuba(t, piece, y, storage);
+      t.sign(false);
+      cpp_int_type result_alias(result.limbs(), offset, rs - offset);
+      add_unsigned(result_alias, result_alias, t);
+   }
+
+   storage.deallocate(t.capacity());
+
+   result.normalize();
+}
+
 inline unsigned karatsuba_storage_size(unsigned s)
 {
-   // 
-   // This estimates how much memory we will need based on
-   // s-limb multiplication.  In an ideal world the number of limbs
-   // would halve with each recursion, and our storage requirements
-   // would be 4s in the limit, and rather less in practice since
-   // we bail out long before we reach one limb.  In the real world
-   // we don't quite halve s in each recursion, so this is an heuristic
-   // which over-estimates how much we need.  We could compute an exact
-   // value, but it would be rather time consuming.
-   //
-   return 5 * s;
+   //
+   // This calculates an upper bound on how much memory we will need
+   // for s-limb multiplication.  At each level of the recursion we
+   // take the largest requirement of the algorithms that may be selected
+   // at that size, and then assume the worst case that the next level
+   // down has only halved in size (as for Karatsuba).  For Toom-Cook
+   // this over-estimates, but the calculation is cheap and safe:
+   //
+   unsigned result = 0;
+   while ((s >= karatsuba_cutoff) && (s > 4))
+   {
+      unsigned level = 4 * (s / 2 + 1) + 4;
+      if (s >= toom3_cutoff)
+         level = (std::max)(level, 12 * ((s + 2) / 3) + 24);
+      if (s >= toom4_cutoff)
+         level = (std::max)(level, 22 * ((s + 3) / 4) + 46);
+      result += level;
+      s = s / 2 + 2;
+   }
+   return result;
 }
 //
 // There are 2 entry point routines for Karatsuba multiplication:
@@ -278,6 +725,10 @@ setup_karatsuba(
    //
    typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
    variable_precision_type a_t(a.limbs(), 0, a.size()), b_t(b.limbs(), 0, b.size());
+   //
+   // Squaring must be passed down with both arguments the same object:
+   //
+   const variable_precision_type& b_ref = (void*)&a == (void*)&b ? a_t : b_t;
    unsigned as = a.size();
    unsigned bs = b.size();
    unsigned s = as > bs ? as : bs;
@@ -290,7 +741,11 @@ setup_karatsuba(
       result.resize(sz, sz);
       variable_precision_type t(result.limbs(), 0, result.size());
       typename variable_precision_type::scoped_shared_storage storage(t.allocator(), storage_size);
-      multiply_karatsuba(t, a_t, b_t, storage);
+      multiply_karatsuba(t, a_t, b_ref, storage);
+      //
+      // The alias normalises itself, but result still has sz limbs:
+      //
+      result.normalize();
    }
    else
    {
@@ -300,7 +755,7 @@ setup_karatsuba(
       //
       typename variable_precision_type::scoped_shared_storage storage(variable_precision_type::allocator_type(), sz + storage_size);
       variable_precision_type t(storage, sz);
-      multiply_karatsuba(t, a_t, b_t, storage);
+      multiply_karatsuba(t, a_t, b_ref, storage);
       //
       // If there is truncation, and result is a checked type then this will throw:
       //
@@ -358,6 +813,139 @@ eval_multiply_comba(
          *pr = static_cast<limb_type>(carry);
    }
 }
+//
+// Squaring: in the schoolbook case each cross product a[i]*a[j] occurs twice, so we
+// sum the products with i < j once, double the result with a left shift, and then
+// add in the squares on the diagonal.  That very nearly halves the number of limb
+// multiplications.  Larger arguments go to the Karatsuba/Toom-Cook code which
+// spots that both arguments are the same object and squares all the way down.
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2>
+inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value>::type
+eval_square(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>& a)
+   BOOST_MP_NOEXCEPT_IF((is_non_throwing_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value 
+      && (karatsuba_cutoff * sizeof(limb_type) * CHAR_BIT > MaxBits1) 
+      && (karatsuba_cutoff * sizeof(limb_type)* CHAR_BIT > MaxBits2)))
+{
+   unsigned                                                                                          as = a.size();
+   typename cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>::const_limb_pointer pa = a.limbs();
+   if (as == 1)
+   {
+      result = static_cast<double_limb_type>(*pa) * static_cast<double_limb_type>(*pa);
+      return;
+   }
+   if ((void*)&result == (void*)&a)
+   {
+      cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> t(a);
+      eval_square(result, t);
+      return;
+   }
+   result.resize(2 * as, 2 * as - 1);
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(as) && (as >= karatsuba_cutoff))
+#else
+   if (as >= karatsuba_cutoff)
+#endif
+   {
+      setup_karatsuba(result, a, a);
+      result.sign(false);
+      return;
+   }
+   typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer pr = result.limbs();
+   //
+   // If the result is a fixed precision type it may have fewer than 2 * as limbs,
+   // in which case the value is truncated, and we need to track whether anything
+   // was lost so that checked types can raise an overflow:
+   //
+   unsigned rs       = result.size();
+   bool     overflow = false;
+
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (BOOST_MP_IS_CONST_EVALUATED(as))
+   {
+      for (unsigned i = 0; i < rs; ++i)
+         pr[i] = 0;
+   }
+   else
+#endif
+   std::memset(pr, 0, rs * sizeof(limb_type));
+   //
+   // Cross products a[i] * a[j] for i < j:
+   //
+   double_limb_type carry = 0;
+   for (unsigned i = 0; i + 1 < as; ++i)
+   {
+      if (2 * i + 1 >= rs)
+      {
+         overflow = true;
+         break;
+      }
+      unsigned inner_limit = (std::min)(as, rs - i);
+      unsigned j           = i + 1;
+      for (; j < inner_limit; ++j)
+      {
+         carry += static_cast<double_limb_type>(pa[i]) * static_cast<double_limb_type>(pa[j]);
+         carry += pr[i + j];
+         pr[i + j] = static_cast<limb_type>(carry);
+         carry >>= cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_bits;
+      }
+      if (i + j < rs)
+         pr[i + j] = static_cast<limb_type>(carry);
+      else if (carry)
+         overflow = true;
+      carry = 0;
+   }
+   //
+   // Double the cross products:
+   //
+   limb_type shifted_out = 0;
+   for (unsigned i = 0; i < rs; ++i)
+   {
+      limb_type l = pr[i];
+      pr[i]       = (l << 1) | shifted_out;
+      shifted_out = l >> (cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_bits - 1);
+   }
+   if (shifted_out)
+      overflow = true;
+   //
+   // Add in the squares a[i]^2 at limb 2 * i:
+   //
+   for (unsigned i = 0; i < as; ++i)
+   {
+      if (2 * i >= rs)
+      {
+         overflow = true;
+         break;
+      }
+      double_limb_type sq = static_cast<double_limb_type>(pa[i]) * static_cast<double_limb_type>(pa[i]);
+      carry += static_cast<double_limb_type>(pr[2 * i]) + static_cast<limb_type>(sq);
+      pr[2 * i] = static_cast<limb_type>(carry);
+      carry >>= cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_bits;
+      sq >>= cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_bits;
+      if (2 * i + 1 < rs)
+      {
+         carry += static_cast<double_limb_type>(pr[2 * i + 1]) + sq;
+         pr[2 * i + 1] = static_cast<limb_type>(carry);
+         carry >>= cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_bits;
+      }
+      else
+      {
+         carry += sq;
+         if (carry)
+            overflow = true;
+      }
+   }
+   if (carry)
+      overflow = true;
+   if (overflow)
+      resize_for_carry(result, 2 * as); // May throw if checking is enabled
+
+   result.normalize();
+   result.sign(false);
+}
+
 template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, unsigned MinBits3, unsigned MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
 inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits3, MaxBits3, SignType3, Checked3, Allocator3> >::value>::type
 eval_multiply(
@@ -402,6 +990,11 @@ eval_multiply(
       return;
    }
 
+   if ((void*)&a == (void*)&b)
+   {
+      eval_square(result, a);
+      return;
+   }
    if ((void*)&result == (void*)&a)
    {
       cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> t(a);
@@ -0,0 +1,307 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Number theoretic transform multiplication for very large cpp_int's.
+//
+// The operands are split into 32-bit digits, and the convolution of the
+// digit sequences is computed modulo three primes of the form k*2^m+1
+// which are all less than 2^30.  The exact convolution is then recovered
+// via the Chinese Remainder Theorem (Garner's algorithm) and the carries
+// propagated.  With 32-bit digits each coefficient of the convolution is
+// bounded by n*2^64, which is below the product of the primes (~2^88) for
+// all transform lengths up to 2^23, so the largest product we can handle
+// directly has 2^23 32-bit digits (2^28 bits).  Larger products are split
+// by the Toom-Cook code until the pieces fit.
+//
+// All modular arithmetic uses 32-bit Montgomery multiplication, and the
+// transforms are a decimation-in-frequency forward transform (natural order
+// in, bit-reversed out) paired with a decimation-in-time inverse
+// (bit-reversed in, natural out), so no bit reversal pass is required.
+//
+#ifndef BOOST_MP_CPP_INT_NTT_HPP
+#define BOOST_MP_CPP_INT_NTT_HPP
+
+#include <vector>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+
+namespace boost { namespace multiprecision { namespace backends { namespace ntt_detail {
+
+//
+// Largest supported transform length (log2), limited by the 2-adic order
+// of the primes, and by the CRT bound above:
+//
+static const unsigned max_log2_length = 23;
+
+class modulus
+{
+ public:
+   explicit modulus(boost::uint32_t p, boost::uint32_t g) : m_p(p)
+   {
+      //
+      // m_pinv = -p^-1 mod 2^32, via Newton iteration (each step doubles
+      // the number of correct bits, p is its own inverse mod 8):
+      //
+      boost::uint32_t inv = p;
+      for (unsigned i = 0; i < 4; ++i)
+         inv *= 2u - p * inv;
+      m_pinv = 0u - inv;
+      boost::uint64_t r = (static_cast<boost::uint64_t>(1u) << 32) % p;
+      m_r  = static_cast<boost::uint32_t>(r);
+      m_r2 = static_cast<boost::uint32_t>((r * r) % p);
+      m_g  = to_mont(g);
+   }
+   boost::uint32_t p() const { return m_p; }
+   boost::uint32_t one() const { return m_r; }
+   //
+   // Montgomery product: returns a * b * 2^-32 mod p.
+   //
+   boost::uint32_t mul(boost::uint32_t a, boost::uint32_t b) const
+   {
+      boost::uint64_t t = static_cast<boost::uint64_t>(a) * b;
+      boost::uint32_t m = static_cast<boost::uint32_t>(t) * m_pinv;
+      return reduce(static_cast<boost::uint32_t>((t + static_cast<boost::uint64_t>(m) * m_p) >> 32));
+   }
+   boost::uint32_t add(boost::uint32_t a, boost::uint32_t b) const
+   {
+      return reduce(a + b);
+   }
+   boost::uint32_t sub(boost::uint32_t a, boost::uint32_t b) const
+   {
+      boost::uint32_t r = a - b;
+      return (std::min)(r, r + m_p);
+   }
+   boost::uint32_t to_mont(boost::uint32_t a) const { return mul(a, m_r2); }
+   //
+   // Montgomery form of x^e, where x is in Montgomery form:
+   //
+   boost::uint32_t pow(boost::uint32_t x, boost::uint32_t e) const
+   {
+      boost::uint32_t r = m_r;
+      while (e)
+      {
+         if (e & 1u)
+            r = mul(r, x);
+         x = mul(x, x);
+         e >>= 1;
+      }
+      return r;
+   }
+   boost::uint32_t inverse(boost::uint32_t x) const { return pow(x, m_p - 2); }
+   //
+   // Montgomery form of a primitive 2^k'th root of unity:
+   //
+   boost::uint32_t root(unsigned k) const { return pow(m_g, (m_p - 1) >> k); }
+
+ private:
+   //
+   // Maps [0, 2p) to [0, p), written so that it compiles to a conditional
+   // move rather than an (unpredictable) branch:
+   //
+   boost::uint32_t reduce(boost::uint32_t r) const
+   {
+      return (std::min)(r, r - m_p);
+   }
+
+   boost::uint32_t m_p, m_pinv, m_r, m_r2, m_g;
+};
+
+//
+// Twiddle factors for a transform of length n: the entries [h, 2h) hold
+// w^j (Montgomery form) for j in [0, h) where w is a primitive 2h'th root.
+// Keeping each level contiguous gives unit stride access in the butterflies.
+//
+inline void make_twiddles(const modulus& m, std::vector<boost::uint32_t>& w, unsigned log2n)
+{
+   unsigned n = 1u << log2n;
+   w.resize(n);
+   for (unsigned k = 1, h = 1; h < n; ++k, h <<= 1)
+   {
+      boost::uint32_t root = m.root(k);
+      boost::uint32_t x    = m.one();
+      for (unsigned j = 0; j < h; ++j)
+      {
+         w[h + j] = x;
+         x        = m.mul(x, root);
+      }
+   }
+}
+
+inline void forward_transform(const modulus& mod, boost::uint32_t* x, const boost::uint32_t* w, unsigned n)
+{
+   const modulus m(mod); // local copy: the compiler can see it's not aliased by x
+   for (unsigned h = n >> 1; h; h >>= 1)
+   {
+      for (unsigned s = 0; s < n; s += 2 * h)
+      {
+         boost::uint32_t* p = x + s;
+         boost::uint32_t* q = p + h;
+         for (unsigned j = 0; j < h; ++j)
+         {
+            boost::uint32_t u = p[j];
+            boost::uint32_t v = q[j];
+            p[j]              = m.add(u, v);
+            q[j]              = m.mul(m.sub(u, v), w[h + j]);
+         }
+      }
+   }
+}
+
+inline void inverse_transform(const modulus& mod, boost::uint32_t* x, const boost::uint32_t* w, unsigned n)
+{
+   const modulus m(mod); // local copy: the compiler can see it's not aliased by x
+   //
+   // Uses w^-j = -w^(h-j) for a primitive 2h'th root w, so that
+   // the forward twiddle table can be reused:
+   //
+   for (unsigned h = 1; h < n; h <<= 1)
+   {
+      for (unsigned s = 0; s < n; s += 2 * h)
+      {
+         boost::uint32_t* p = x + s;
+         boost::uint32_t* q = p + h;
+         boost::uint32_t  u = p[0];
+         boost::uint32_t  v = q[0];
+         p[0]               = m.add(u, v);
+         q[0]               = m.sub(u, v);
+         for (unsigned j = 1; j < h; ++j)
+         {
+            u    = p[j];
+            v    = m.mul(q[j], w[2 * h - j]);
+            p[j] = m.sub(u, v);
+            q[j] = m.add(u, v);
+         }
+      }
+   }
+}
+
+//
+// Splits a limb array into 32-bit digits reduced modulo p, zero padded to length n:
+//
+template <class Limb>
+inline void load_digits(const modulus& m, boost::uint32_t* x, const Limb* p, unsigned len, unsigned n)
+{
+   static const unsigned digits_per_limb = sizeof(Limb) / sizeof(boost::uint32_t);
+   unsigned              k               = 0;
+   for (unsigned i = 0; i < len; ++i)
+   {
+      Limb l = p[i];
+      for (unsigned j = 0; j < digits_per_limb; ++j)
+      {
+         x[k++] = static_cast<boost::uint32_t>(l) % m.p();
+         if (digits_per_limb > 1)
+            l >>= 16, l >>= 16;
+      }
+   }
+   for (; k < n; ++k)
+      x[k] = 0;
+}
+
+//
+// Computes the cyclic convolution of a and b modulo m, leaving the result in r
+// in natural order, scratch must have n elements if a and b are different:
+//
+template <class Limb>
+inline void convolve(const modulus& m, std::vector<boost::uint32_t>& r, std::vector<boost::uint32_t>& scratch, std::vector<boost::uint32_t>& w, const Limb* a, unsigned as, const Limb* b, unsigned bs, unsigned log2n)
+{
+   unsigned n = 1u << log2n;
+   make_twiddles(m, w, log2n);
+   r.resize(n);
+   load_digits(m, &r[0], a, as, n);
+   forward_transform(m, &r[0], &w[0], n);
+   //
+   // k = n^-1 * 2^64 mod p, corrects for both the transform scaling and
+   // the extra factor of 2^-32 introduced by the pointwise Montgomery product:
+   //
+   const boost::uint32_t k = m.to_mont(m.inverse(m.to_mont(n)));
+   if ((a == b) && (as == bs))
+   {
+      for (unsigned i = 0; i < n; ++i)
+         r[i] = m.mul(m.mul(r[i], r[i]), k);
+   }
+   else
+   {
+      scratch.resize(n);
+      load_digits(m, &scratch[0], b, bs, n);
+      forward_transform(m, &scratch[0], &w[0], n);
+      for (unsigned i = 0; i < n; ++i)
+         r[i] = m.mul(m.mul(r[i], scratch[i]), k);
+   }
+   inverse_transform(m, &r[0], &w[0], n);
+}
+
+//
+// Returns true if the product of an as-limb and a bs-limb number can be
+// computed by this method:
+//
+template <class Limb>
+inline bool can_multiply(unsigned as, unsigned bs)
+{
+   return (static_cast<boost::uint64_t>(as) + bs) * (sizeof(Limb) / sizeof(boost::uint32_t)) <= (static_cast<boost::uint64_t>(1u) << max_log2_length);
+}
+
+//
+// Sets r[0, as+bs) to a * b, r must not overlap a or b:
+//
+template <class Limb>
+void multiply(Limb* r, const Limb* a, unsigned as, const Limb* b, unsigned bs)
+{
+   static const unsigned digits_per_limb = sizeof(Limb) / sizeof(boost::uint32_t);
+   BOOST_STATIC_ASSERT(digits_per_limb && (sizeof(Limb) % sizeof(boost::uint32_t) == 0));
+   BOOST_ASSERT(can_multiply<Limb>(as, bs));
+
+   unsigned rd    = (as + bs) * digits_per_limb;
+   unsigned log2n = 0;
+   while ((1u << log2n) < rd)
+      ++log2n;
+
+   const modulus m1(998244353u, 3u), m2(754974721u, 11u), m3(469762049u, 3u);
+
+   std::vector<boost::uint32_t> r1, r2, r3, scratch, w;
+   convolve(m1, r1, scratch, w, a, as, b, bs, log2n);
+   convolve(m2, r2, scratch, w, a, as, b, bs, log2n);
+   convolve(m3, r3, scratch, w, a, as, b, bs, log2n);
+   //
+   // Garner's algorithm: each coefficient is x = r1 + p1 * t2 + p1 * p2 * t3
+   // with t2 < p2 and t3 < p3.  The constants below are all in Montgomery form so
+   // that a single Montgomery product multiplies by the plain value:
+   //
+   const boost::uint32_t p1_inv_2    = m2.inverse(m2.to_mont(m1.p() % m2.p()));
+   const boost::uint32_t p1_3        = m3.to_mont(m1.p() % m3.p());
+   const boost::uint32_t p1p2_inv_3  = m3.inverse(m3.mul(p1_3, m3.to_mont(m2.p() % m3.p())));
+   const boost::uint64_t p1p2        = static_cast<boost::uint64_t>(m1.p()) * m2.p();
+   const boost::uint64_t p1p2_lo     = p1p2 & 0xFFFFFFFFu;
+   const boost::uint64_t p1p2_hi     = p1p2 >> 32;
+
+   boost::uint64_t carry = 0;
+   unsigned        k     = 0;
+   for (unsigned i = 0; i < as + bs; ++i)
+   {
+      Limb l = 0;
+      for (unsigned j = 0; j < digits_per_limb; ++j, ++k)
+      {
+         boost::uint32_t a1 = r1[k];
+         boost::uint32_t t2 = m2.mul(m2.sub(r2[k], a1 % m2.p()), p1_inv_2);
+         boost::uint32_t t3 = m3.sub(r3[k], a1 % m3.p());
+         t3                 = m3.sub(t3, m3.mul(t2 % m3.p(), p1_3));
+         t3                 = m3.mul(t3, p1p2_inv_3);
+         //
+         // x = v + lo + (hi << 32) with v, lo < 2^62 and hi < 2^58, so we can
+         // add in the carry and split off the low 32 bits without overflow:
+         //
+         boost::uint64_t v  = a1 + static_cast<boost::uint64_t>(m1.p()) * t2;
+         boost::uint64_t lo = p1p2_lo * t3;
+         boost::uint64_t s0 = (v & 0xFFFFFFFFu) + (lo & 0xFFFFFFFFu) + (carry & 0xFFFFFFFFu);
+         carry              = (v >> 32) + (lo >> 32) + p1p2_hi * t3 + (carry >> 32) + (s0 >> 32);
+         l |= static_cast<Limb>(static_cast<Limb>(static_cast<boost::uint32_t>(s0)) << (j * 32));
+      }
+      r[i] = l;
+   }
+   BOOST_ASSERT(carry == 0);
+}
+
+}}}} // namespace boost::multiprecision::backends::ntt_detail
+
+#endif
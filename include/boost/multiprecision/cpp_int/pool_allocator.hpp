@@ -0,0 +1,201 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// A limb allocator for cpp_int which rounds each request up to a power of two
+// size class and keeps a small per-thread cache of freed blocks for each class,
+// so that the temporaries created and destroyed during expression evaluation
+// rarely reach the global heap.  Since blocks are rounded up, cpp_int_base::resize
+// can often grow a value within its existing block.  The cache holds whole
+// blocks obtained from operator new, so blocks may be freed by a different
+// thread from the one that allocated them, and are returned to the heap on
+// thread exit.  Without thread local storage there is no cache, only the
+// rounding.
+//
+#ifndef BOOST_MP_CPP_INT_POOL_ALLOCATOR_HPP
+#define BOOST_MP_CPP_INT_POOL_ALLOCATOR_HPP
+
+#include <boost/multiprecision/detail/number_base.hpp>
+#include <cstddef>
+#include <new>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Number of size classes, which start at 16 bytes and double from there, larger
+// requests go straight to operator new:
+//
+#ifdef BOOST_MP_CPP_INT_POOL_CLASSES
+static const unsigned limb_pool_classes = BOOST_MP_CPP_INT_POOL_CLASSES;
+#else
+static const unsigned limb_pool_classes = 11;
+#endif
+//
+// Maximum number of free blocks cached per size class per thread:
+//
+#ifdef BOOST_MP_CPP_INT_POOL_CACHE
+static const unsigned limb_pool_cache = BOOST_MP_CPP_INT_POOL_CACHE;
+#else
+static const unsigned limb_pool_cache = 64;
+#endif
+
+static const std::size_t limb_pool_min_block = 16;
+
+inline unsigned limb_pool_class(std::size_t bytes)
+{
+   unsigned k = 0;
+   while ((k < limb_pool_classes) && ((limb_pool_min_block << k) < bytes))
+      ++k;
+   return k;
+}
+//
+// The usable size of the block returned for a request of bytes bytes:
+//
+inline std::size_t limb_pool_block_size(std::size_t bytes)
+{
+   unsigned k = limb_pool_class(bytes);
+   return k < limb_pool_classes ? limb_pool_min_block << k : bytes;
+}
+
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+//
+// The free lists are threaded through the free blocks themselves.  This is trivially
+// destructible so that it is still usable by values destroyed after the thread's cleanup
+// object, which empties it and disables the cache:
+//
+struct limb_pool
+{
+   void*    free_list[limb_pool_classes];
+   unsigned cached[limb_pool_classes];
+   bool     registered, destroyed;
+};
+
+inline limb_pool& thread_limb_pool()
+{
+   static BOOST_MP_THREAD_LOCAL limb_pool pool;
+   return pool;
+}
+
+struct limb_pool_cleanup
+{
+   ~limb_pool_cleanup()
+   {
+      limb_pool& pool = thread_limb_pool();
+      for (unsigned k = 0; k < limb_pool_classes; ++k)
+      {
+         while (pool.free_list[k])
+         {
+            void* p           = pool.free_list[k];
+            pool.free_list[k] = *static_cast<void**>(p);
+            ::operator delete(p);
+         }
+         pool.cached[k] = 0;
+      }
+      pool.destroyed = true;
+   }
+};
+#endif
+
+inline void* limb_pool_allocate(std::size_t bytes)
+{
+   unsigned k = limb_pool_class(bytes);
+   if (k >= limb_pool_classes)
+      return ::operator new(bytes);
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+   limb_pool& pool = thread_limb_pool();
+   if (pool.free_list[k])
+   {
+      void* p           = pool.free_list[k];
+      pool.free_list[k] = *static_cast<void**>(p);
+      --pool.cached[k];
+      return p;
+   }
+   if (!pool.registered && !pool.destroyed)
+   {
+      pool.registered = true;
+      static BOOST_MP_THREAD_LOCAL limb_pool_cleanup cleanup;
+      (void)cleanup;
+   }
+#endif
+   return ::operator new(limb_pool_min_block << k);
+}
+
+inline void limb_pool_deallocate(void* p, std::size_t bytes)
+{
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+   unsigned k = limb_pool_class(bytes);
+   if (k < limb_pool_classes)
+   {
+      limb_pool& pool = thread_limb_pool();
+      if (pool.registered && !pool.destroyed && (pool.cached[k] < limb_pool_cache))
+      {
+         *static_cast<void**>(p) = pool.free_list[k];
+         pool.free_list[k]       = p;
+         ++pool.cached[k];
+         return;
+      }
+   }
+#else
+   (void)bytes;
+#endif
+   ::operator delete(p);
+}
+
+} // namespace detail
+
+template <class T>
+class cpp_int_pool_allocator
+{
+ public:
+   typedef T              value_type;
+   typedef T*             pointer;
+   typedef const T*       const_pointer;
+   typedef T&             reference;
+   typedef const T&       const_reference;
+   typedef std::size_t    size_type;
+   typedef std::ptrdiff_t difference_type;
+
+   template <class U>
+   struct rebind
+   {
+      typedef cpp_int_pool_allocator<U> other;
+   };
+
+   cpp_int_pool_allocator() BOOST_NOEXCEPT {}
+   template <class U>
+   cpp_int_pool_allocator(const cpp_int_pool_allocator<U>&) BOOST_NOEXCEPT {}
+
+   T* allocate(std::size_t n, const void* = 0)
+   {
+      return static_cast<T*>(detail::limb_pool_allocate(n * sizeof(T)));
+   }
+   void deallocate(T* p, std::size_t n)
+   {
+      detail::limb_pool_deallocate(p, n * sizeof(T));
+   }
+   std::size_t max_size() const BOOST_NOEXCEPT { return ~static_cast<std::size_t>(0u) / sizeof(T); }
+   void        construct(T* p, const T& val) { ::new (static_cast<void*>(p)) T(val); }
+   void        destroy(T* p) { p->~T(); }
+};
+
+template <class T, class U>
+inline bool operator==(const cpp_int_pool_allocator<T>&, const cpp_int_pool_allocator<U>&) BOOST_NOEXCEPT { return true; }
+template <class T, class U>
+inline bool operator!=(const cpp_int_pool_allocator<T>&, const cpp_int_pool_allocator<U>&) BOOST_NOEXCEPT { return false; }
+
+//
+// Called by cpp_int_base::resize: a block of n values can grow in place to fill its size class:
+//
+template <class T>
+inline unsigned expand_limbs_in_place(cpp_int_pool_allocator<T>&, T*, unsigned n, unsigned new_size)
+{
+   std::size_t cap = detail::limb_pool_block_size(n * sizeof(T)) / sizeof(T);
+   return cap >= new_size ? static_cast<unsigned>(cap) : 0u;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -0,0 +1,387 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Divide and conquer radix conversion for cpp_int_backend.
+//
+#ifndef BOOST_MP_CPP_INT_RADIX_HPP
+#define BOOST_MP_CPP_INT_RADIX_HPP
+
+#include <vector>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// Minimum number of limbs for divide and conquer radix conversion to beat
+// repeated division by a single limb:
+//
+#ifdef BOOST_MP_DC_RADIX_CUTOFF
+const size_t dc_radix_cutoff = BOOST_MP_DC_RADIX_CUTOFF;
+#else
+const size_t dc_radix_cutoff = 50;
+#endif
+//
+// Largest number of limbs converted in a local buffer rather than a temporary integer:
+//
+const size_t local_radix_limbs = 64;
+
+//
+// Writes the decimal digits of the size limbs at pl to [first, last), padded on the left
+// with zeros, the value must be less than 10^(last - first) and is destroyed in the process:
+//
+inline void write_decimal_digits_basecase(char* first, char* last, limb_type* pl, unsigned size)
+{
+   while (last != first)
+   {
+      //
+      // Divide in place by max_block_10:
+      //
+      limb_type r = 0;
+      for (unsigned i = size; i-- > 0;)
+      {
+         double_limb_type a = (static_cast<double_limb_type>(r) << (sizeof(limb_type) * CHAR_BIT)) | pl[i];
+         pl[i]              = static_cast<limb_type>(a / max_block_10);
+         r                  = static_cast<limb_type>(a % max_block_10);
+      }
+      while ((size > 1) && !pl[size - 1])
+         --size;
+      for (unsigned i = 0; (i < digits_per_block_10) && (last != first); ++i)
+      {
+         *--last = static_cast<char>('0' + r % 10);
+         r /= 10;
+      }
+      if ((size == 1) && (pl[0] == 0))
+      {
+         std::memset(first, '0', last - first);
+         return;
+      }
+   }
+}
+template <class CppInt>
+inline void write_decimal_digits_basecase(char* first, char* last, CppInt& x)
+{
+   write_decimal_digits_basecase(first, last, x.limbs(), x.size());
+}
+//
+// As above, powers[i] holds 10^(digits_per_block_10 * 2^i) and x < powers[k]^2:
+//
+template <class CppInt>
+void write_decimal_digits(char* first, char* last, CppInt& x, const std::vector<CppInt>& powers, unsigned k)
+{
+   if (x.size() < dc_radix_cutoff)
+   {
+      write_decimal_digits_basecase(first, last, x);
+      return;
+   }
+   while (k && (x.compare(powers[k]) < 0))
+      --k;
+   CppInt q, r;
+   divide_unsigned_helper(&q, x, powers[k], r);
+   std::size_t low_digits = static_cast<std::size_t>(digits_per_block_10) << k;
+   BOOST_ASSERT(low_digits <= static_cast<std::size_t>(last - first));
+   write_decimal_digits(last - low_digits, last, r, powers, k ? k - 1 : 0);
+   write_decimal_digits(first, last - low_digits, q, powers, k ? k - 1 : 0);
+}
+//
+// Writes the decimal digits of the magnitude of x to [first, last), padded on the left
+// with zeros, splitting x by a cached table of powers of 10 when x is large:
+//
+template <class CppInt>
+void write_decimal_digits(char* first, char* last, const CppInt& x)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   if (x.size() < (std::min)(dc_radix_cutoff, local_radix_limbs))
+   {
+      //
+      // Small values are destroyed in a local copy, no allocation required:
+      //
+      limb_type local[local_radix_limbs];
+      std::memcpy(local, x.limbs(), x.size() * sizeof(limb_type));
+      write_decimal_digits_basecase(first, last, local, x.size());
+      return;
+   }
+   const variable_precision_type x_t(x.limbs(), 0, x.size());
+   variable_precision_type       t;
+   t = x_t;
+   t.sign(false);
+   if (t.size() < dc_radix_cutoff)
+   {
+      write_decimal_digits_basecase(first, last, t);
+      return;
+   }
+   std::vector<variable_precision_type> powers(1);
+   powers[0] = max_block_10;
+   //
+   // Square until the last power squared is certain to exceed t:
+   //
+   while (2 * powers.back().size() - 1 <= t.size())
+   {
+      variable_precision_type p;
+      eval_multiply(p, powers.back(), powers.back());
+      powers.push_back(p);
+   }
+   write_decimal_digits(first, last, t, powers, static_cast<unsigned>(powers.size() - 1));
+}
+
+//
+// Sets x to the value of the decimal digits in [first, last), one block of
+// digits_per_block_10 digits at a time:
+//
+template <class CppInt>
+void read_decimal_digits_basecase(CppInt& x, const char* first, const char* last)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_multiply;
+
+   x = static_cast<limb_type>(0u);
+   while (first != last)
+   {
+      limb_type block = 0;
+      unsigned  i     = 0;
+      for (; (i < digits_per_block_10) && (first != last); ++i, ++first)
+      {
+         if (*first < '0' || *first > '9')
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected character encountered in input."));
+         block *= 10;
+         block += *first - '0';
+      }
+      eval_multiply(x, block_multiplier(i - 1));
+      eval_add(x, block);
+   }
+}
+//
+// As above, powers[i] holds 10^(digits_per_block_10 * 2^i), and the low digits
+// are split off in blocks of those sizes:
+//
+template <class CppInt>
+void read_decimal_digits(CppInt& x, const char* first, const char* last, const std::vector<CppInt>& powers)
+{
+   std::size_t n = last - first;
+   if (n < dc_radix_cutoff * digits_per_block_10)
+   {
+      read_decimal_digits_basecase(x, first, last);
+      return;
+   }
+   unsigned k = static_cast<unsigned>(powers.size() - 1);
+   while (k && ((static_cast<std::size_t>(digits_per_block_10) << k) >= n))
+      --k;
+   std::size_t low_digits = static_cast<std::size_t>(digits_per_block_10) << k;
+   CppInt      high, low;
+   read_decimal_digits(high, first, last - low_digits, powers);
+   read_decimal_digits(low, last - low_digits, last, powers);
+   eval_multiply(x, high, powers[k]);
+   eval_add(x, low);
+}
+//
+// Sets result to the value of the decimal digits in [first, last), building large
+// values from a product tree of powers of 10:
+//
+template <class CppInt>
+void read_decimal_digits(CppInt& result, const char* first, const char* last)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   std::size_t n = last - first;
+   if (n < dc_radix_cutoff * digits_per_block_10)
+   {
+      read_decimal_digits_basecase(result, first, last);
+      return;
+   }
+   std::vector<variable_precision_type> powers(1);
+   powers[0] = max_block_10;
+   while ((static_cast<std::size_t>(digits_per_block_10) << powers.size()) < n)
+   {
+      variable_precision_type p;
+      eval_multiply(p, powers.back(), powers.back());
+      powers.push_back(p);
+   }
+   variable_precision_type t;
+   read_decimal_digits(t, first, last, powers);
+   //
+   // If there is truncation, and result is a checked type then this will throw:
+   //
+   result = t;
+}
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, class Traits>
+inline void assign_from_string_view(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result, const std::basic_string_view<char, Traits>& view)
+{
+   //
+   // Parse directly from the view, no temporary string required:
+   //
+   result.assign_string(view.data(), view.data() + view.size());
+}
+#endif
+//
+// Writes the digits of the magnitude of x in base 8 or 16 (shift is 3 or 4) to [first, last),
+// returns the end of the digits, or a null pointer if there is not enough room:
+//
+template <class CppInt>
+char* write_radix_chars(char* first, char* last, const CppInt& x, unsigned shift, bool uppercase)
+{
+   const limb_type* pl   = x.limbs();
+   unsigned         size = x.size();
+   std::size_t      bits = (size - 1) * static_cast<std::size_t>(CppInt::limb_bits) + (pl[size - 1] ? boost::multiprecision::detail::find_msb(pl[size - 1]) + 1 : 0);
+   std::size_t      n    = bits ? (bits + shift - 1) / shift : 1;
+   if (n > static_cast<std::size_t>(last - first))
+      return 0;
+   limb_type mask     = static_cast<limb_type>((1u << shift) - 1);
+   char      letter_a = uppercase ? 'A' : 'a';
+   char*     p        = first + n;
+   //
+   // Walk the limbs directly, picking out shift bits at a time:
+   //
+   for (std::size_t bit = 0; p != first; bit += shift)
+   {
+      std::size_t limb   = bit / CppInt::limb_bits;
+      unsigned    offset = bit % CppInt::limb_bits;
+      limb_type   v      = pl[limb] >> offset;
+      if ((offset + shift > CppInt::limb_bits) && (limb + 1 < size))
+         v |= pl[limb + 1] << (CppInt::limb_bits - offset);
+      char c = static_cast<char>('0' + (v & mask));
+      if (c > '9')
+         c += letter_a - '9' - 1;
+      *--p = c;
+   }
+   return first + n;
+}
+//
+// Writes the decimal digits of the magnitude of x to [first, last), returns the end of the digits,
+// or a null pointer if there is not enough room:
+//
+template <class CppInt>
+char* write_decimal_chars(char* first, char* last, const CppInt& x)
+{
+   //
+   // We need room for an upper bound on the digit count, use [first, last) if there is room
+   // and strip the leading zeros afterwards:
+   //
+   const limb_type*  pl    = x.limbs();
+   unsigned          size  = x.size();
+   boost::uintmax_t  bits  = (size - 1) * static_cast<boost::uintmax_t>(CppInt::limb_bits) + (pl[size - 1] ? boost::multiprecision::detail::find_msb(pl[size - 1]) + 1 : 0);
+   std::size_t       bound = static_cast<std::size_t>(bits * 30103u / 100000u) + 1;
+   char              local[256];
+   std::vector<char> storage;
+   char*             buf;
+   if (bound <= static_cast<std::size_t>(last - first))
+      buf = first;
+   else if (bound <= sizeof(local))
+      buf = local;
+   else
+   {
+      storage.resize(bound);
+      buf = &storage[0];
+   }
+   write_decimal_digits(buf, buf + bound, x);
+   const char* p = buf;
+   while ((p != buf + bound - 1) && (*p == '0'))
+      ++p;
+   std::size_t n = buf + bound - p;
+   if (n > static_cast<std::size_t>(last - first))
+      return 0;
+   std::memmove(first, p, n);
+   return first + n;
+}
+//
+// Writes x to [first, last) in the format given by f, returns the end of the characters written,
+// or a null pointer if there is not enough room.  Negative values may only be written in base 10:
+//
+template <class CppInt>
+char* write_integer_chars(char* first, char* last, const CppInt& x, std::ios_base::fmtflags f, const mpl::false_&)
+{
+   bool uppercase = (f & std::ios_base::uppercase) == std::ios_base::uppercase;
+   if (((f & std::ios_base::oct) == std::ios_base::oct) || ((f & std::ios_base::hex) == std::ios_base::hex))
+   {
+      BOOST_ASSERT(!x.sign());
+      unsigned shift = (f & std::ios_base::oct) == std::ios_base::oct ? 3 : 4;
+      if (f & std::ios_base::showbase)
+      {
+         if (last - first < (shift == 3 ? 1 : 2))
+            return 0;
+         *first++ = '0';
+         if (shift == 4)
+            *first++ = uppercase ? 'X' : 'x';
+      }
+      return write_radix_chars(first, last, x, shift, uppercase);
+   }
+   if (x.sign() || (f & std::ios_base::showpos))
+   {
+      if (first == last)
+         return 0;
+      *first++ = x.sign() ? '-' : '+';
+   }
+   return write_decimal_chars(first, last, x);
+}
+template <class CppInt>
+char* write_integer_chars(char* first, char* last, const CppInt& x, std::ios_base::fmtflags f, const mpl::true_&)
+{
+   //
+   // Trivial integers follow the iostream conventions: no base prefix on zero, except
+   // for double limb types which can't go through the iostreams and always get one:
+   //
+   typename CppInt::local_limb_type v = *x.limbs();
+#ifdef BOOST_MP_NO_DOUBLE_LIMB_TYPE_IO
+   bool prefix_zero = is_same<typename CppInt::local_limb_type, double_limb_type>::value;
+#else
+   bool prefix_zero = false;
+#endif
+   unsigned                         base = 10;
+   if ((f & std::ios_base::oct) == std::ios_base::oct)
+      base = 8;
+   else if ((f & std::ios_base::hex) == std::ios_base::hex)
+      base = 16;
+   BOOST_ASSERT((base == 10) || !x.sign());
+   char  buf[sizeof(v) * CHAR_BIT / 3 + 1];
+   char* p        = buf + sizeof(buf);
+   char  letter_a = f & std::ios_base::uppercase ? 'A' : 'a';
+   do
+   {
+      char c = static_cast<char>('0' + static_cast<unsigned>(v % base));
+      if (c > '9')
+         c += letter_a - '9' - 1;
+      *--p = c;
+      v /= base;
+   } while (v);
+   const char* prefix = "";
+   if (base == 10)
+      prefix = x.sign() ? "-" : f & std::ios_base::showpos ? "+" : "";
+   else if ((f & std::ios_base::showbase) && (*x.limbs() || prefix_zero))
+      prefix = base == 8 ? "0" : f & std::ios_base::uppercase ? "0X" : "0x";
+   std::size_t prefix_size = std::strlen(prefix);
+   std::size_t n           = buf + sizeof(buf) - p;
+   if (prefix_size + n > static_cast<std::size_t>(last - first))
+      return 0;
+   std::memcpy(first, prefix, prefix_size);
+   std::memcpy(first + prefix_size, p, n);
+   return first + prefix_size + n;
+}
+
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline to_chars_result eval_to_chars(char* first, char* last, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, std::streamsize, std::ios_base::fmtflags f)
+{
+   to_chars_result result = {last, std::errc::invalid_argument};
+   if (val.sign() && (((f & std::ios_base::oct) == std::ios_base::oct) || ((f & std::ios_base::hex) == std::ios_base::hex)))
+      return result;
+   if (char* p = write_integer_chars(first, last, val, f, typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::trivial_tag()))
+   {
+      result.ptr = p;
+      result.ec  = std::errc();
+   }
+   else
+      result.ec = std::errc::value_too_large;
+   return result;
+}
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void eval_from_chars(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result, const char* first, const char* last)
+{
+   result.assign_string(first, last);
+}
+#endif
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Integer square root with remainder for cpp_int_backend, using the recursive
+// algorithm from "Karatsuba Square Root", Paul Zimmermann, INRIA RR-3805, 1999.
+// The square root of an n bit value costs about the same as a couple of n bit
+// divisions, so this inherits whatever multiplication and division algorithms
+// are in use at each size.
+//
+#ifndef BOOST_MP_CPP_INT_SQRT_HPP
+#define BOOST_MP_CPP_INT_SQRT_HPP
+
+#include <cmath>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// Number of limbs at which the Karatsuba square root takes over from the
+// bit by bit method in default_ops:
+//
+#ifdef BOOST_MP_KARATSUBA_SQRT_CUTOFF
+const size_t karatsuba_sqrt_cutoff = BOOST_MP_KARATSUBA_SQRT_CUTOFF;
+#else
+const size_t karatsuba_sqrt_cutoff = 2;
+#endif
+
+//
+// Square root with remainder of a 64-bit value, the floating point estimate
+// may be out by one either way:
+//
+inline boost::uint64_t sqrt_rem_64(boost::uint64_t x, boost::uint64_t& r)
+{
+   boost::uint64_t s = static_cast<boost::uint64_t>(std::sqrt(static_cast<double>(x)));
+   if (s > 0xFFFFFFFFuLL)
+      s = 0xFFFFFFFFuLL;
+   while (s * s > x)
+      --s;
+   while ((s < 0xFFFFFFFFuLL) && ((s + 1) * (s + 1) <= x))
+      ++s;
+   r = x - s * s;
+   return s;
+}
+//
+// Sets r to the lowest bits bits of x:
+//
+template <class CppInt>
+void sqrt_low_bits(CppInt& r, const CppInt& x, unsigned bits)
+{
+   unsigned n = (bits + CppInt::limb_bits - 1) / CppInt::limb_bits;
+   r          = x;
+   if (r.size() >= n)
+   {
+      r.resize(n, n);
+      if (bits % CppInt::limb_bits)
+         r.limbs()[n - 1] &= (static_cast<limb_type>(1u) << (bits % CppInt::limb_bits)) - 1;
+      r.normalize();
+   }
+}
+//
+// Sets s to the integer square root of x > 0 and r to the remainder x - s^2.  With x
+// normalised to 4k bits (or 4k - 1) we split it into four k bit pieces
+// a3 b^3 + a2 b^2 + a1 b + a0 for b = 2^k, then the square root s' of a3 b + a2 gives
+// the high half of s and the quotient of (r' b + a1) / 2s' the low half, with at
+// most one correction step:
+//
+template <class CppInt>
+void sqrt_rem_karatsuba(CppInt& s, CppInt& r, const CppInt& x)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_get_sign;
+   using default_ops::eval_increment;
+   using default_ops::eval_decrement;
+   using default_ops::eval_left_shift;
+   using default_ops::eval_msb;
+   using default_ops::eval_multiply;
+   using default_ops::eval_right_shift;
+   using default_ops::eval_subtract;
+
+   unsigned bits = eval_msb(x) + 1;
+   if (bits <= 64)
+   {
+      boost::uint64_t v = 0, rem;
+      for (unsigned i = 0; i < x.size(); ++i)
+         v |= static_cast<boost::uint64_t>(x.limbs()[i]) << (i * CppInt::limb_bits);
+      s = static_cast<boost::ulong_long_type>(sqrt_rem_64(v, rem));
+      r = static_cast<boost::ulong_long_type>(rem);
+      return;
+   }
+   unsigned k     = (bits + 3) / 4;
+   unsigned shift = (4 * k - bits) / 2;
+   CppInt   a(x), t, q, a_low;
+   if (shift)
+      eval_left_shift(a, 2 * shift);
+
+   eval_right_shift(t, a, 2 * k);
+   sqrt_rem_karatsuba(s, r, t);
+   //
+   // (q, u) = divide(r' b + a1, 2s'), and the new s is s' b + q:
+   //
+   eval_right_shift(t, a, k);
+   sqrt_low_bits(a_low, t, k);
+   eval_left_shift(r, k);
+   eval_add(r, a_low);
+   eval_left_shift(t, s, 1);
+   divide_unsigned_helper(&q, r, t, r);
+   eval_left_shift(s, k);
+   eval_add(s, q);
+   //
+   // The remainder is u b + a0 - q^2, if that is negative s is one too large:
+   //
+   sqrt_low_bits(a_low, a, k);
+   eval_left_shift(r, k);
+   eval_add(r, a_low);
+   eval_multiply(t, q, q);
+   eval_subtract(r, t);
+   if (eval_get_sign(r) < 0)
+   {
+      eval_add(r, s);
+      eval_add(r, s);
+      eval_decrement(r);
+      eval_decrement(s);
+   }
+   //
+   // Undo the normalisation, we shifted by at most 2 bits so the low bit s0 of the
+   // root is all that matters: x = (s >> 1)^2 + (r + 2 s0 s - s0) / 4:
+   //
+   if (shift)
+   {
+      if (s.limbs()[0] & 1u)
+      {
+         eval_add(r, s);
+         eval_add(r, s);
+         eval_decrement(r);
+      }
+      eval_right_shift(r, 2);
+      eval_right_shift(s, 1);
+   }
+}
+
+//
+// The intermediate values may be a couple of bits wider than x, and the remainder
+// may go negative, so the work is done in a variable precision signed type:
+//
+template <class CppInt>
+void eval_integer_sqrt_karatsuba(CppInt& s, CppInt& r, const CppInt& x)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> > variable_precision_type;
+
+   const variable_precision_type x_alias(x.limbs(), 0, x.size());
+   variable_precision_type       vx, vs, vr;
+   vx = x_alias;
+   sqrt_rem_karatsuba(vs, vr, vx);
+   s = vs;
+   r = vr;
+}
+
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_integer_sqrt(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       s,
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       r,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& x)
+{
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(x.size()) && (x.size() >= karatsuba_sqrt_cutoff) && !x.sign())
+#else
+   if ((x.size() >= karatsuba_sqrt_cutoff) && !x.sign())
+#endif
+   {
+      eval_integer_sqrt_karatsuba(s, r, x);
+      return;
+   }
+   default_ops::eval_integer_sqrt(s, r, x);
+}
+
+//
+// The residue modulo 64 comes straight from the low limb, which rejects most non-squares
+// without touching the rest of the value:
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value, bool>::type
+eval_is_perfect_square(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& x)
+{
+   if (x.sign())
+      return false;
+   if ((x.size() == 1) && (*x.limbs() == 0))
+      return true;
+   return default_ops::is_square_mod_64(static_cast<unsigned>(*x.limbs() & 63u)) && default_ops::perfect_square_test(x);
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
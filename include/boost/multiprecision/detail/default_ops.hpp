@@ -422,6 +422,15 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_multiply(T& t, const U& u, const V& v)
 {
    eval_multiply_default(t, u, v);
 }
+//
+// Squaring: backends which can do better than a general product (cpp_int for
+// example) provide their own overload:
+//
+template <class T, class U>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_square(T& t, const U& u)
+{
+   eval_multiply(t, u, u);
+}
 
 template <class T>
 inline BOOST_MP_CXX14_CONSTEXPR void eval_multiply_add(T& t, const T& u, const T& v, const T& x)
@@ -865,6 +874,66 @@ inline void assign_from_string_view(Result& result, const std::basic_string_view
    assign_components(result, x.c_str(), y.c_str());
 }
 #endif
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+template <class Backend>
+inline to_chars_result eval_to_chars(char* first, char* last, const Backend& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   //
+   // Default version goes via the string conversion, backends which can
+   // write straight to the buffer should overload this:
+   //
+   to_chars_result result;
+   std::string     s;
+#ifndef BOOST_NO_EXCEPTIONS
+   try
+   {
+#endif
+      s = val.str(digits, f);
+#ifndef BOOST_NO_EXCEPTIONS
+   }
+   catch (const std::runtime_error&)
+   {
+      // The format is not supported for this value (for example negative hex integers):
+      result.ptr = last;
+      result.ec  = std::errc::invalid_argument;
+      return result;
+   }
+#endif
+   if (s.size() > static_cast<std::size_t>(last - first))
+   {
+      result.ptr = last;
+      result.ec  = std::errc::value_too_large;
+   }
+   else
+   {
+      std::memcpy(first, s.data(), s.size());
+      result.ptr = first + s.size();
+      result.ec  = std::errc();
+   }
+   return result;
+}
+template <class Backend>
+inline void eval_from_chars(Backend& result, const char* first, const char* last)
+{
+   //
+   // Backends require a null-terminated string, use a local copy when we can
+   // to save an allocation:
+   //
+   char        buf[128];
+   std::size_t n = last - first;
+   if (n < sizeof(buf))
+   {
+      std::memcpy(buf, first, n);
+      buf[n] = 0;
+      result = static_cast<const char*>(buf);
+   }
+   else
+   {
+      std::string s(first, last);
+      result = s.c_str();
+   }
+}
+#endif
 template <class R, int b>
 struct has_enough_bits
 {
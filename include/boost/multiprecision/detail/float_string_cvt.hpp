@@ -13,6 +13,7 @@
 #define BOOST_MP_FLOAT_STRING_CVT_HPP
 
 #include <cctype>
+#include <cstring>
 
 namespace boost { namespace multiprecision { namespace detail {
 
@@ -41,6 +42,31 @@ inline void round_string_up_at(std::string& s, int pos, I& expon)
    }
 }
 
+template <class I>
+inline void round_chars_up_at(char* s, std::size_t n, int pos, I& expon)
+{
+   //
+   // As above, but for the n digits at s:
+   //
+   if (pos < 0)
+   {
+      std::memmove(s + 1, s, n - 1);
+      *s = '1';
+      ++expon;
+   }
+   else if (s[pos] == '9')
+   {
+      s[pos] = '0';
+      round_chars_up_at(s, n, pos - 1, expon);
+   }
+   else
+   {
+      if ((pos == 0) && (s[pos] == '0') && (n == 1))
+         ++expon;
+      ++s[pos];
+   }
+}
+
 template <class Backend>
 std::string convert_to_string(Backend b, std::streamsize digits, std::ios_base::fmtflags f)
 {
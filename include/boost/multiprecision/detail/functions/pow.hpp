@@ -54,7 +54,7 @@ inline void pow_imp(T& result, const T& t, const U& p, const mpl::false_&)
    while (U(p2 /= 2) != U(0))
    {
       // Square x for each binary power.
-      eval_multiply(x, x);
+      eval_square(x, x);
 
       const bool has_binary_power = (U(p2 % U(2)) != U(0));
 
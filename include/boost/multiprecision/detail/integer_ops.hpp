@@ -123,6 +123,130 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_lcm(B& result, const B& a, const B& b)
       result.negate();
 }
 
+//
+// Extended Euclid on u >= v >= 0: s0 and s1 are the magnitudes of the cofactors giving u and v
+// in terms of whatever quantity the caller is interested in, and likewise *t0 and *t1 if they are
+// not null.  The signs of the cofactors alternate from one step to the next, so we only need to
+// track the sign of s0 in neg.  On exit u is the gcd and s0 its cofactor:
+//
+template <class B>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_gcdext_euclid(B& u, B& v, B& s0, B& s1, B* t0, B* t1, bool& neg)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_is_zero;
+   using default_ops::eval_multiply;
+   using default_ops::eval_qr;
+
+   B q, r;
+   while (!eval_is_zero(v))
+   {
+      eval_qr(u, v, q, r);
+      u.swap(v);
+      v.swap(r);
+      if (t0)
+      {
+         eval_multiply(r, q, *t1);
+         eval_add(r, *t0);
+         t0->swap(*t1);
+         t1->swap(r);
+      }
+      eval_multiply(q, s1);
+      eval_add(q, s0);
+      s0.swap(s1);
+      s1.swap(q);
+      neg = !neg;
+   }
+}
+//
+// Both cofactors are tracked, rather than finding t at the end by division, as the intermediate
+// product s * a may overflow a fixed precision type:
+//
+template <class B>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_gcdext(B& g, B& s, B& t, const B& a, const B& b)
+{
+   typedef typename mpl::front<typename B::unsigned_types>::type ui_type;
+
+   using default_ops::eval_get_sign;
+   using default_ops::eval_is_zero;
+
+   B u(a), v(b), s0, s1, t0, t1;
+   if (eval_get_sign(u) < 0)
+      u.negate();
+   if (eval_get_sign(v) < 0)
+      v.negate();
+   s0 = ui_type(1u);
+   s1 = ui_type(0u);
+   t0 = ui_type(0u);
+   t1 = ui_type(1u);
+   bool neg = false;
+   if (u.compare(v) < 0)
+   {
+      u.swap(v);
+      s0.swap(s1);
+      t0.swap(t1);
+      neg = true;
+   }
+   eval_gcdext_euclid(u, v, s0, s1, &t0, &t1, neg);
+   if (eval_is_zero(u))
+   {
+      s0 = ui_type(0u);
+      t0 = ui_type(0u);
+   }
+   //
+   // The cofactors have opposite signs, so are s0 and -t0 up to a sign flip:
+   //
+   if (neg)
+      s0.negate();
+   else
+      t0.negate();
+   if (eval_get_sign(a) < 0)
+      s0.negate();
+   if (eval_get_sign(b) < 0)
+      t0.negate();
+   g = u;
+   s = s0;
+   t = t0;
+}
+//
+// Sets result to the inverse of a modulo m in [0, |m|) and returns true, or returns false if there
+// is no such inverse.  As we only track the magnitude of the cofactor this works for unsigned types too:
+//
+template <class B>
+inline BOOST_MP_CXX14_CONSTEXPR bool eval_invert_mod(B& result, const B& a, const B& m)
+{
+   typedef typename mpl::front<typename B::unsigned_types>::type ui_type;
+
+   using default_ops::eval_add;
+   using default_ops::eval_eq;
+   using default_ops::eval_get_sign;
+   using default_ops::eval_is_zero;
+   using default_ops::eval_modulus;
+   using default_ops::eval_subtract;
+
+   B y(m), u, v, s0, s1;
+   if (eval_get_sign(y) < 0)
+      y.negate();
+   if (eval_is_zero(y))
+      return false;
+   eval_modulus(v, a, y);
+   if (eval_get_sign(v) < 0)
+      eval_add(v, y);
+   u        = y;
+   s0       = ui_type(0u);
+   s1       = ui_type(1u);
+   bool neg = true;
+   eval_gcdext_euclid(u, v, s0, s1, static_cast<B*>(0), static_cast<B*>(0), neg);
+   if (!eval_eq(u, ui_type(1u)))
+      return false;
+   if (neg && !eval_is_zero(s0))
+   {
+      eval_subtract(y, s0);
+      s0.swap(y);
+   }
+   result = s0;
+   return true;
+}
+
 } // namespace default_ops
 
 template <class Backend, expression_template_option ExpressionTemplates>
@@ -174,6 +298,31 @@ integer_modulus(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x
    return integer_modulus(result_type(x), val);
 }
 
+template <class Backend, expression_template_option ExpressionTemplates>
+inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+gcdext(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b,
+       number<Backend, ExpressionTemplates>& s, number<Backend, ExpressionTemplates>& t)
+{
+   BOOST_STATIC_ASSERT_MSG((std::numeric_limits<number<Backend, ExpressionTemplates> >::is_signed), "gcdext requires a signed type as the cofactors may be negative.");
+   using default_ops::eval_gcdext;
+   number<Backend, ExpressionTemplates> g;
+   eval_gcdext(g.backend(), s.backend(), t.backend(), a.backend(), b.backend());
+   return g;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+invert_mod(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& m)
+{
+   using default_ops::eval_invert_mod;
+   number<Backend, ExpressionTemplates> result;
+   if (!eval_invert_mod(result.backend(), a.backend(), m.backend()))
+   {
+      BOOST_THROW_EXCEPTION(std::domain_error("invert_mod requires a and m to be coprime, and m to be non-zero."));
+   }
+   return result;
+}
+
 template <class Backend, expression_template_option ExpressionTemplates>
 inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<number_category<Backend>::value == number_kind_integer, unsigned>::type
 lsb(const number<Backend, ExpressionTemplates>& x)
@@ -292,6 +441,7 @@ BOOST_MP_CXX14_CONSTEXPR void eval_powm(Backend& result, const Backend& a, const
    using default_ops::eval_modulus;
    using default_ops::eval_multiply;
    using default_ops::eval_right_shift;
+   using default_ops::eval_square;
 
    typedef typename double_precision_type<Backend>::type                                       double_type;
    typedef typename boost::multiprecision::detail::canonical<unsigned char, double_type>::type ui_type;
@@ -308,7 +458,7 @@ BOOST_MP_CXX14_CONSTEXPR void eval_powm(Backend& result, const Backend& a, const
          eval_multiply(t, x, y);
          eval_modulus(x, t, c);
       }
-      eval_multiply(t, y, y);
+      eval_square(t, y);
       eval_modulus(y, t, c);
       eval_right_shift(b, ui_type(1));
    }
@@ -329,6 +479,7 @@ BOOST_MP_CXX14_CONSTEXPR void eval_powm(Backend& result, const Backend& a, const
    using default_ops::eval_modulus;
    using default_ops::eval_multiply;
    using default_ops::eval_right_shift;
+   using default_ops::eval_square;
 
    check_sign_of_backend(p, mpl::bool_<std::numeric_limits<number<Backend> >::is_signed>());
 
@@ -347,7 +498,7 @@ BOOST_MP_CXX14_CONSTEXPR void eval_powm(Backend& result, const Backend& a, const
          eval_multiply(t, x, y);
          eval_modulus(x, t, static_cast<i1_type>(c));
       }
-      eval_multiply(t, y, y);
+      eval_square(t, y);
       eval_modulus(y, t, static_cast<i1_type>(c));
       eval_right_shift(b, ui_type(1));
    }
@@ -366,6 +517,7 @@ BOOST_MP_CXX14_CONSTEXPR typename enable_if<is_unsigned<Integer> >::type eval_po
    using default_ops::eval_modulus;
    using default_ops::eval_multiply;
    using default_ops::eval_right_shift;
+   using default_ops::eval_square;
 
    double_type x, y(a), t;
    x = ui_type(1u);
@@ -377,7 +529,7 @@ BOOST_MP_CXX14_CONSTEXPR typename enable_if<is_unsigned<Integer> >::type eval_po
          eval_multiply(t, x, y);
          eval_modulus(x, t, c);
       }
-      eval_multiply(t, y, y);
+      eval_square(t, y);
       eval_modulus(y, t, c);
       b >>= 1;
    }
@@ -408,6 +560,7 @@ BOOST_MP_CXX14_CONSTEXPR typename enable_if<is_unsigned<Integer1> >::type eval_p
    using default_ops::eval_modulus;
    using default_ops::eval_multiply;
    using default_ops::eval_right_shift;
+   using default_ops::eval_square;
 
    double_type x, y(a), t;
    x = ui_type(1u);
@@ -419,7 +572,7 @@ BOOST_MP_CXX14_CONSTEXPR typename enable_if<is_unsigned<Integer1> >::type eval_p
          eval_multiply(t, x, y);
          eval_modulus(x, t, static_cast<i1_type>(c));
       }
-      eval_multiply(t, y, y);
+      eval_square(t, y);
       eval_modulus(y, t, static_cast<i1_type>(c));
       b >>= 1;
    }
@@ -446,6 +599,278 @@ struct powm_func
    }
 };
 
+//
+// Sets result to the integer k'th root of x >= 0 by Newton iteration from above.  The
+// starting point comes from the root of the leading half of the digits, so only the
+// last couple of iterations are at full precision.  The powers of the approximation
+// are formed in double_type, as they may exceed x before the iteration settles:
+//
+template <class B>
+void eval_integer_root_unsigned(B& result, const B& x, unsigned k)
+{
+   typedef typename double_precision_type<B>::type                                        double_type;
+   typedef typename boost::multiprecision::detail::canonical<unsigned, double_type>::type ui_type;
+   typedef typename boost::multiprecision::detail::canonical<unsigned char, B>::type      uc_type;
+
+   using default_ops::eval_add;
+   using default_ops::eval_divide;
+   using default_ops::eval_increment;
+   using default_ops::eval_integer_sqrt;
+   using default_ops::eval_is_zero;
+   using default_ops::eval_left_shift;
+   using default_ops::eval_msb;
+   using default_ops::eval_multiply;
+   using default_ops::eval_right_shift;
+
+   if (eval_is_zero(x) || (k == 1))
+   {
+      result = x;
+      return;
+   }
+   if (k == 2)
+   {
+      B r;
+      eval_integer_sqrt(result, r, x);
+      return;
+   }
+   unsigned root_bits = (eval_msb(x) + k) / k; // the root is less than 2^root_bits
+   if (root_bits == 1)
+   {
+      result = uc_type(1u);
+      return;
+   }
+   double_type s, t, u, dx(x);
+   if (root_bits <= 16)
+   {
+      s = ui_type(1u);
+      eval_left_shift(s, root_bits);
+   }
+   else
+   {
+      //
+      // If y is the root of x >> kh then the root of x is less than (y + 1) << h:
+      //
+      unsigned h = root_bits / 2;
+      B        y, xh;
+      eval_right_shift(xh, x, k * h);
+      eval_integer_root_unsigned(y, xh, k);
+      s = y;
+      eval_increment(s);
+      eval_left_shift(s, h);
+   }
+   while (true)
+   {
+      //
+      // t = x / s^(k-1), which is zero once the power exceeds x:
+      //
+      u = ui_type(1u);
+      for (unsigned i = 1; i < k; ++i)
+      {
+         eval_multiply(u, s);
+         if (u.compare(dx) > 0)
+            break;
+      }
+      if (u.compare(dx) > 0)
+         t = ui_type(0u);
+      else
+         eval_divide(t, dx, u);
+      eval_multiply(u, s, ui_type(k - 1));
+      eval_add(u, t);
+      eval_divide(u, ui_type(k));
+      if (u.compare(s) >= 0)
+         break;
+      s.swap(u);
+   }
+   result = s;
+}
+//
+// Sets result to the integer k'th root of x, rounded towards zero, k must be
+// odd if x is negative:
+//
+template <class B>
+inline void eval_integer_root(B& result, const B& x, unsigned k)
+{
+   using default_ops::eval_get_sign;
+
+   if (eval_get_sign(x) < 0)
+   {
+      B t(x);
+      t.negate();
+      eval_integer_root_unsigned(result, t, k);
+      result.negate();
+   }
+   else
+      eval_integer_root_unsigned(result, x, k);
+}
+
+//
+// Quadratic residue filters: bit r of each mask is set when r is a square modulo 64, 63, 65
+// and 11.  Together they reject all but about 1 in 120 non-squares, the residue 64 modulo
+// 65 does not fit in the mask and is handled separately:
+//
+inline bool is_square_mod_64(unsigned r)
+{
+   return (0x0202021202030213uLL >> r) & 1u;
+}
+inline bool is_square_mod_63_65_11(unsigned r)
+{
+   unsigned r65 = r % 65;
+   return ((0x0402483012450293uLL >> (r % 63)) & 1u) && ((r65 == 64) || ((0x218A019866014613uLL >> r65) & 1u)) && ((0x23Bu >> (r % 11)) & 1u);
+}
+//
+// The rest of the perfect square test for x > 0 once the residue of x modulo 64 has passed,
+// the square root is only computed once the remaining filters have passed too:
+//
+template <class B>
+bool perfect_square_test(const B& x)
+{
+   using default_ops::eval_integer_modulus;
+   using default_ops::eval_integer_sqrt;
+   using default_ops::eval_is_zero;
+
+   if (!is_square_mod_63_65_11(eval_integer_modulus(x, 63u * 65u * 11u)))
+      return false;
+   B s, r;
+   eval_integer_sqrt(s, r, x);
+   return eval_is_zero(r);
+}
+
+template <class B>
+bool eval_is_perfect_square(const B& x)
+{
+   using default_ops::eval_get_sign;
+   using default_ops::eval_integer_modulus;
+
+   int sign = eval_get_sign(x);
+   if (sign <= 0)
+      return sign == 0;
+   return is_square_mod_64(eval_integer_modulus(x, 64u)) && perfect_square_test(x);
+}
+//
+// Trial division for the small odd values used below:
+//
+inline bool is_small_odd_prime(unsigned p)
+{
+   for (unsigned d = 3; d * d <= p; d += 2)
+      if (p % d == 0)
+         return false;
+   return true;
+}
+inline boost::uint64_t pow_mod_small(boost::uint64_t b, unsigned e, boost::uint64_t m)
+{
+   boost::uint64_t result = 1;
+   for (; e; e >>= 1)
+   {
+      if (e & 1u)
+         result = result * b % m;
+      b = b * b % m;
+   }
+   return result;
+}
+//
+// Returns false if x is certainly not a p'th power: for primes q = kp + 1 a p'th power is
+// either zero modulo q or has x^((q-1)/p) = 1 mod q, which a random value only has a 1 in
+// p chance of satisfying:
+//
+template <class B>
+bool is_power_residue(const B& x, unsigned p)
+{
+   using default_ops::eval_integer_modulus;
+
+   unsigned tested = 0;
+   for (boost::uint64_t q = 2 * static_cast<boost::uint64_t>(p) + 1; (q < 0x80000000uLL) && (tested < 2); q += 2 * p)
+   {
+      if (!is_small_odd_prime(static_cast<unsigned>(q)))
+         continue;
+      ++tested;
+      boost::uint64_t r = eval_integer_modulus(x, static_cast<unsigned>(q));
+      if (r && (pow_mod_small(r, static_cast<unsigned>((q - 1) / p), q) != 1))
+         return false;
+   }
+   return true;
+}
+//
+// Returns true if x is r^p for the integer p'th root r of x:
+//
+template <class B>
+bool is_exact_power(const B& x, unsigned p)
+{
+   typedef typename boost::multiprecision::detail::canonical<unsigned char, B>::type ui_type;
+
+   using default_ops::eval_eq;
+   using default_ops::eval_multiply;
+
+   B r, y, t;
+   eval_integer_root(r, x, p);
+   y = ui_type(1u);
+   for (; p; p >>= 1)
+   {
+      //
+      // Every power formed here is at most r^p <= x, so fixed precision types can't overflow:
+      //
+      if (p & 1u)
+      {
+         eval_multiply(t, y, r);
+         y.swap(t);
+      }
+      if (p > 1)
+      {
+         eval_multiply(t, r, r);
+         r.swap(t);
+      }
+   }
+   return eval_eq(y, x);
+}
+//
+// Returns true if x is a^b for integers a and b > 1, where 0 and 1 count as perfect powers and
+// negative x requires b to be odd.  With x = 2^v * m and m odd, b must divide v, and m must be a
+// b'th power for some prime b no larger than the bit count of m, so after checking for a square
+// we try each odd prime in turn, testing the root only when the residue filter passes:
+//
+template <class B>
+bool eval_is_perfect_power(const B& x)
+{
+   typedef typename boost::multiprecision::detail::canonical<unsigned char, B>::type ui_type;
+
+   using default_ops::eval_eq;
+   using default_ops::eval_get_sign;
+   using default_ops::eval_lsb;
+   using default_ops::eval_msb;
+   using default_ops::eval_right_shift;
+
+   int sign = eval_get_sign(x);
+   if (sign == 0)
+      return true;
+   B m(x);
+   if (sign < 0)
+      m.negate();
+   if (eval_eq(m, ui_type(1u)))
+      return true;
+   if ((sign > 0) && eval_is_perfect_square(m))
+      return true;
+   unsigned v = eval_lsb(m);
+   if (v == 1)
+      return false;
+   eval_right_shift(m, v);
+   if (eval_eq(m, ui_type(1u)))
+   {
+      //
+      // x is +-2^v with v > 1: the positive values are all powers (even v having been found
+      // to be a square already) and the negative ones are if v has an odd factor:
+      //
+      return (v & (v - 1)) != 0;
+   }
+   unsigned max_p = eval_msb(m);
+   for (unsigned p = 3; p <= max_p; p += 2)
+   {
+      if ((v && (v % p)) || !is_small_odd_prime(p))
+         continue;
+      if (is_power_residue(m, p) && is_exact_power(m, p))
+         return true;
+   }
+   return false;
+}
+
 } // namespace default_ops
 
 template <class T, class U, class V>
@@ -479,6 +904,64 @@ powm(const T& b, const U& p, const V& mod)
        default_ops::powm_func(), b, p, mod);
 }
 
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+integer_root(const number<Backend, ExpressionTemplates>& x, unsigned k)
+{
+   using default_ops::eval_integer_root;
+   if (k == 0)
+   {
+      BOOST_THROW_EXCEPTION(std::domain_error("integer_root requires k > 0."));
+   }
+   if (!(k & 1u) && (x.sign() < 0))
+   {
+      BOOST_THROW_EXCEPTION(std::domain_error("integer_root requires k to be odd when x is negative."));
+   }
+   number<Backend, ExpressionTemplates> result;
+   eval_integer_root(result.backend(), x.backend(), k);
+   return result;
+}
+
+template <class tag, class A1, class A2, class A3, class A4>
+inline typename enable_if_c<number_category<typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type>::value == number_kind_integer, typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type>::type
+integer_root(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x, unsigned k)
+{
+   typedef typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type number_type;
+   return integer_root(number_type(x), k);
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<number_category<Backend>::value == number_kind_integer, bool>::type
+is_perfect_square(const number<Backend, ExpressionTemplates>& x)
+{
+   using default_ops::eval_is_perfect_square;
+   return eval_is_perfect_square(x.backend());
+}
+
+template <class tag, class A1, class A2, class A3, class A4>
+inline typename enable_if_c<number_category<typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type>::value == number_kind_integer, bool>::type
+is_perfect_square(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x)
+{
+   typedef typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type number_type;
+   return is_perfect_square(number_type(x));
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<number_category<Backend>::value == number_kind_integer, bool>::type
+is_perfect_power(const number<Backend, ExpressionTemplates>& x)
+{
+   using default_ops::eval_is_perfect_power;
+   return eval_is_perfect_power(x.backend());
+}
+
+template <class tag, class A1, class A2, class A3, class A4>
+inline typename enable_if_c<number_category<typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type>::value == number_kind_integer, bool>::type
+is_perfect_power(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x)
+{
+   typedef typename multiprecision::detail::expression<tag, A1, A2, A3, A4>::result_type number_type;
+   return is_perfect_power(number_type(x));
+}
+
 }} // namespace boost::multiprecision
 
 #endif
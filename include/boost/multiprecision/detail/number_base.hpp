@@ -21,6 +21,9 @@
 #ifdef BOOST_MSVC
 #pragma warning(pop)
 #endif
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+#include <system_error>
+#endif
 
 #if defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_NO_CXX11_TEMPLATE_ALIASES) || defined(BOOST_NO_CXX11_HDR_ARRAY)\
       || defined(BOOST_NO_CXX11_ALLOCATOR) || defined(BOOST_NO_CXX11_UNIFIED_INITIALIZATION_SYNTAX) || defined(BOOST_NO_CXX11_CONSTEXPR)\
@@ -188,6 +191,23 @@ struct expression;
 
 } // namespace detail
 
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+//
+// Results of to_chars and from_chars, these mirror std::to_chars_result and
+// std::from_chars_result which are not available prior to C++17:
+//
+struct to_chars_result
+{
+   char*     ptr;
+   std::errc ec;
+};
+struct from_chars_result
+{
+   const char* ptr;
+   std::errc   ec;
+};
+#endif
+
 template <class T>
 struct is_number_expression : public mpl::false_
 {};
@@ -1641,6 +1661,173 @@ void format_float_string(S& str, boost::intmax_t my_exp, boost::intmax_t digits,
       str.insert(static_cast<std::string::size_type>(0), 1, '+');
 }
 
+//
+// As format_float_string, but writes the result to [first, last) rather than building up a string.
+// The digits are in [p, p + n) and the sign is passed separately.  Returns the end of the characters
+// written, or a null pointer if [first, last) is too small:
+//
+inline char* format_float_chars(char* first, char* last, const char* p, std::size_t n, bool neg, boost::intmax_t my_exp, boost::intmax_t digits, std::ios_base::fmtflags f, bool iszero)
+{
+   bool scientific = (f & std::ios_base::scientific) == std::ios_base::scientific;
+   bool fixed      = (f & std::ios_base::fixed) == std::ios_base::fixed;
+   bool showpoint  = (f & std::ios_base::showpoint) == std::ios_base::showpoint;
+   bool showpos    = (f & std::ios_base::showpos) == std::ios_base::showpos;
+
+   if (digits == 0)
+   {
+      digits = (std::max)(n, std::size_t(16));
+   }
+   //
+   // Everything is written as: sign, digits[0, n), trailing_zeros zeros, with the decimal point and any
+   // leading zeros inserted, and then any exponent.  Start by working out how much room we need:
+   //
+   std::size_t     leading_zeros  = 0;
+   std::size_t     trailing_zeros = 0;
+   boost::intmax_t point          = -1; // digits before the decimal point, or -1 for none.
+   boost::intmax_t fraction_zeros = 0;  // zeros after all the digits when fixed.
+   bool            exponent       = false;
+   bool            all_zero       = iszero || (n == 0);
+   for (std::size_t i = 0; !all_zero && (i < n) && (p[i] == '0'); ++i)
+   {
+      if (i + 1 == n)
+         all_zero = true;
+   }
+
+   if (all_zero)
+   {
+      //
+      // We will be printing zero, even though the value might not
+      // actually be zero (it just may have been rounded to zero):
+      //
+      p = "0";
+      n = 1;
+      if (scientific || fixed)
+      {
+         point          = 1;
+         fraction_zeros = digits;
+         exponent       = scientific;
+         my_exp         = 0;
+      }
+      else if (showpoint)
+      {
+         point          = 1;
+         fraction_zeros = digits > 1 ? digits - 1 : 0;
+      }
+   }
+   else
+   {
+      if (!fixed && !scientific && !showpoint)
+      {
+         //
+         // Suppress trailing zeros:
+         //
+         while (p[n - 1] == '0')
+            --n;
+      }
+      else if (!fixed || (my_exp >= 0))
+      {
+         //
+         // Pad out the end with zero's if we need to:
+         //
+         boost::intmax_t chars = digits - static_cast<boost::intmax_t>(n);
+         if (scientific)
+            ++chars;
+         if (chars > 0)
+            trailing_zeros = static_cast<std::size_t>(chars);
+      }
+      boost::intmax_t size = static_cast<boost::intmax_t>(n + trailing_zeros);
+
+      if (fixed || (!scientific && (my_exp >= -4) && (my_exp < digits)))
+      {
+         boost::intmax_t fraction = 0;
+         if (1 + my_exp > size)
+         {
+            // Just pad out the end with zeros:
+            trailing_zeros += static_cast<std::size_t>(1 + my_exp - size);
+            if (showpoint || fixed)
+               point = 1 + my_exp;
+         }
+         else if (my_exp + 1 < size)
+         {
+            if (my_exp < 0)
+            {
+               leading_zeros = static_cast<std::size_t>(-my_exp);
+               point         = 1;
+               fraction      = size - my_exp - 1;
+            }
+            else
+            {
+               point    = my_exp + 1;
+               fraction = size - my_exp - 1;
+            }
+         }
+         else if (showpoint || fixed) // we have exactly the digits we require to left of the point
+            point = size;
+
+         if (fixed && (digits > fraction))
+            fraction_zeros = digits - fraction;
+      }
+      else
+      {
+         // Scientific format:
+         if (showpoint || (size > 1))
+            point = 1;
+         exponent = true;
+      }
+   }
+   //
+   // The exponent has at least BOOST_MP_MIN_EXPONENT_DIGITS digits:
+   //
+   char             exponent_digits[std::numeric_limits<boost::uintmax_t>::digits10 + 1];
+   std::size_t      exponent_size = 0;
+   boost::uintmax_t e             = my_exp < 0 ? 0u - static_cast<boost::uintmax_t>(my_exp) : static_cast<boost::uintmax_t>(my_exp);
+   if (exponent)
+   {
+      do
+      {
+         exponent_digits[exponent_size++] = static_cast<char>('0' + e % 10);
+         e /= 10;
+      } while (e);
+      while (exponent_size < BOOST_MP_MIN_EXPONENT_DIGITS)
+         exponent_digits[exponent_size++] = '0';
+   }
+   std::size_t total = (neg || showpos ? 1 : 0) + leading_zeros + n + trailing_zeros + (point >= 0 ? 1 : 0) + static_cast<std::size_t>(fraction_zeros) + (exponent ? exponent_size + 2 : 0);
+   if (total > static_cast<std::size_t>(last - first))
+      return 0;
+   //
+   // Now write everything out:
+   //
+   if (neg)
+      *first++ = '-';
+   else if (showpos)
+      *first++ = '+';
+   std::size_t before_point = point < 0 ? static_cast<std::size_t>(-1) : static_cast<std::size_t>(point);
+   std::size_t pos          = 0;
+   for (std::size_t i = 0; i < leading_zeros + n + trailing_zeros; ++i, ++pos)
+   {
+      if (pos == before_point)
+         *first++ = '.';
+      if (i < leading_zeros)
+         *first++ = '0';
+      else if (i < leading_zeros + n)
+         *first++ = p[i - leading_zeros];
+      else
+         *first++ = '0';
+   }
+   if (pos == before_point)
+      *first++ = '.';
+   std::memset(first, '0', static_cast<std::size_t>(fraction_zeros));
+   first += fraction_zeros;
+   if (exponent)
+   {
+      *first++ = 'e';
+      *first++ = my_exp < 0 ? '-' : '+';
+      while (exponent_size)
+         *first++ = exponent_digits[--exponent_size];
+   }
+   return first;
+}
+
 template <class V>
 BOOST_MP_CXX14_CONSTEXPR void check_shift_range(V val, const mpl::true_&, const mpl::true_&)
 {
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// A minimal work stealing thread pool for running a batch of numbered tasks.  When
+// the C++11 thread library is not available the tasks are run serially on the calling
+// thread, and BOOST_MP_HAS_PARALLEL_TASKS is left undefined.
+//
+#ifndef BOOST_MP_DETAIL_PARALLEL_TASKS_HPP
+#define BOOST_MP_DETAIL_PARALLEL_TASKS_HPP
+
+#include <boost/config.hpp>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_MUTEX) && !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_EXCEPTION)
+#define BOOST_MP_HAS_PARALLEL_TASKS
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+#ifdef BOOST_MP_HAS_PARALLEL_TASKS
+
+//
+// The tasks belonging to one worker, which takes them from the front while idle
+// workers steal from the back:
+//
+class task_queue
+{
+   std::mutex              m_mutex;
+   std::deque<std::size_t> m_tasks;
+
+ public:
+   void push(std::size_t i)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push_back(i);
+   }
+   bool pop(std::size_t& i)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_tasks.empty())
+         return false;
+      i = m_tasks.front();
+      m_tasks.pop_front();
+      return true;
+   }
+   bool steal(std::size_t& i)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_tasks.empty())
+         return false;
+      i = m_tasks.back();
+      m_tasks.pop_back();
+      return true;
+   }
+};
+
+template <class F>
+class task_worker
+{
+   std::vector<task_queue>& m_queues;
+   std::size_t              m_index;
+   F&                       m_f;
+   std::atomic<bool>&       m_stop;
+   std::exception_ptr&      m_error;
+   std::mutex&              m_error_mutex;
+
+ public:
+   task_worker(std::vector<task_queue>& queues, std::size_t index, F& f, std::atomic<bool>& stop, std::exception_ptr& error, std::mutex& error_mutex)
+       : m_queues(queues), m_index(index), m_f(f), m_stop(stop), m_error(error), m_error_mutex(error_mutex) {}
+
+   void operator()()
+   {
+      try
+      {
+         std::size_t task;
+         while (!m_stop.load(std::memory_order_relaxed) && next(task))
+            m_f(task);
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(m_error_mutex);
+         if (!m_error)
+            m_error = std::current_exception();
+         m_stop.store(true);
+      }
+   }
+
+ private:
+   bool next(std::size_t& task)
+   {
+      if (m_queues[m_index].pop(task))
+         return true;
+      for (std::size_t i = 1; i < m_queues.size(); ++i)
+      {
+         if (m_queues[(m_index + i) % m_queues.size()].steal(task))
+            return true;
+      }
+      return false;
+   }
+};
+
+//
+// The number of threads to use when asked for threads, zero meaning as many as the hardware supports:
+//
+inline unsigned parallel_thread_count(unsigned threads)
+{
+   return threads ? threads : (std::max)(std::thread::hardware_concurrency(), 1u);
+}
+
+//
+// Calls f(i) for each i in [0, count) using up to threads threads, the calling thread
+// included, or std::thread::hardware_concurrency() threads when threads is zero.  The
+// tasks are dealt out in turn, so that the lowest numbered are started first, and any
+// cancellation is up to f.  The first exception thrown by f is rethrown here once all
+// the threads have finished:
+//
+template <class F>
+void parallel_for_tasks(std::size_t count, unsigned threads, F& f)
+{
+   threads = parallel_thread_count(threads);
+   if (threads > count)
+      threads = static_cast<unsigned>((std::max)(count, static_cast<std::size_t>(1u)));
+
+   std::vector<task_queue> queues(threads);
+   for (std::size_t i = 0; i < count; ++i)
+      queues[i % threads].push(i);
+
+   std::atomic<bool>        stop(false);
+   std::exception_ptr       error;
+   std::mutex               error_mutex;
+   std::vector<std::thread> pool;
+   for (unsigned i = 1; i < threads; ++i)
+      pool.push_back(std::thread(task_worker<F>(queues, i, f, stop, error, error_mutex)));
+   task_worker<F>(queues, 0, f, stop, error, error_mutex)();
+   for (std::size_t i = 0; i < pool.size(); ++i)
+      pool[i].join();
+   if (error)
+      std::rethrow_exception(error);
+}
+
+#else
+
+inline unsigned parallel_thread_count(unsigned)
+{
+   return 1;
+}
+
+template <class F>
+void parallel_for_tasks(std::size_t count, unsigned, F& f)
+{
+   for (std::size_t i = 0; i < count; ++i)
+      f(i);
+}
+
+#endif
+
+}}} // namespace boost::multiprecision::detail
+
+#endif
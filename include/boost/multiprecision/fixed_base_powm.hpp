@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Exponentiation of a fixed base modulo a fixed modulus, using the
+// precomputed powers g^(2^(k*w)) and Yao's method, see:
+// E. F. Brickell, D. M. Gordon, K. S. McCurley and D. B. Wilson,
+// "Fast Exponentiation with Precomputation", EUROCRYPT '92.
+//
+#ifndef BOOST_MP_FIXED_BASE_POWM_HPP
+#define BOOST_MP_FIXED_BASE_POWM_HPP
+
+#include <boost/multiprecision/modular_adaptor.hpp>
+
+namespace boost {
+namespace multiprecision {
+
+//
+// Writing the exponent in base 2^w as sum(e_k * 2^(k*w)), g^e is the product of
+// g_k^e_k with g_k = g^(2^(k*w)) precomputed.  Yao's method forms this as
+// prod(d^(product of g_k with e_k = d)) for d = 1 ... 2^w-1, so each call needs about
+// max_bits / w + 2^w multiplications and no squarings at all, compared to max_bits
+// squarings for eval_powm.  The object is immutable once constructed, so may be
+// shared between threads:
+//
+template <class Number>
+class fixed_base_powm
+{
+   BOOST_STATIC_ASSERT_MSG(is_number<Number>::value && (number_category<Number>::value == number_kind_integer), "fixed_base_powm requires a multiprecision integer type.");
+
+   typedef typename Number::backend_type backend_type;
+
+   Number                       m_base, m_modulus;
+   modular_params<backend_type> m_params;
+   std::vector<backend_type>    m_table;
+   unsigned                     m_window;
+
+ public:
+   //
+   // Precomputes for exponents of up to max_bits bits, larger exponents
+   // fall back to powm.  The modulus must be positive:
+   //
+   fixed_base_powm(const Number& g, const Number& m, unsigned max_bits)
+       : m_base(g), m_modulus(m), m_params(m.backend()), m_window(1)
+   {
+      //
+      // Choose w to minimise the multiplications, ceil(max_bits / w) + 2^w:
+      //
+      if (!max_bits)
+         max_bits = 1;
+      unsigned cost = max_bits + 2;
+      for (unsigned w = 2; w < 16; ++w)
+      {
+         unsigned c = (max_bits + w - 1) / w + (1u << w);
+         if (c >= cost)
+            break;
+         cost     = c;
+         m_window = w;
+      }
+      const backends::modular_context<backend_type>& ctx = m_params.context();
+      m_table.resize((max_bits + m_window - 1) / m_window);
+      ctx.to_internal(m_table[0], g.backend());
+      ctx.from_internal(m_base.backend(), m_table[0]);
+      for (std::size_t k = 1; k < m_table.size(); ++k)
+      {
+         backend_type t(m_table[k - 1]);
+         for (unsigned i = 0; i < m_window; ++i)
+         {
+            ctx.square(m_table[k], t);
+            t.swap(m_table[k]);
+         }
+         m_table[k].swap(t);
+      }
+   }
+
+   const Number& base() const { return m_base; }
+   const Number& modulus() const { return m_modulus; }
+   unsigned      max_bits() const { return static_cast<unsigned>(m_table.size()) * m_window; }
+
+   //
+   // Returns g^e mod m, in the range [0, m):
+   //
+   Number operator()(const Number& e) const
+   {
+      if (e < 0)
+         BOOST_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+      if (e == 0)
+         return powm(m_base, e, m_modulus);
+      unsigned bits = msb(e) + 1;
+      if (bits > max_bits())
+         return powm(m_base, e, m_modulus);
+
+      const unsigned        digit_count = (bits + m_window - 1) / m_window;
+      std::vector<unsigned> digits(digit_count);
+      unsigned              max_digit = 0;
+      for (unsigned k = 0; k < digit_count; ++k)
+      {
+         unsigned d = 0;
+         for (unsigned i = m_window; i > 0; --i)
+            d = (d << 1) | static_cast<unsigned>(bit_test(e, k * m_window + i - 1));
+         digits[k] = d;
+         max_digit = (std::max)(max_digit, d);
+      }
+      //
+      // a accumulates the result and b the product of g_k with e_k >= d,
+      // both start at 1 which we track separately to avoid multiplying by it:
+      //
+      const backends::modular_context<backend_type>& ctx = m_params.context();
+      backend_type                                   a, b, t;
+      bool                                           a_one = true, b_one = true;
+      for (unsigned d = max_digit; d > 0; --d)
+      {
+         for (unsigned k = 0; k < digit_count; ++k)
+         {
+            if (digits[k] != d)
+               continue;
+            if (b_one)
+            {
+               b     = m_table[k];
+               b_one = false;
+            }
+            else
+            {
+               ctx.multiply(t, b, m_table[k]);
+               b.swap(t);
+            }
+         }
+         if (b_one)
+            continue;
+         if (a_one)
+         {
+            a     = b;
+            a_one = false;
+         }
+         else
+         {
+            ctx.multiply(t, a, b);
+            a.swap(t);
+         }
+      }
+      Number result;
+      ctx.from_internal(result.backend(), a);
+      return result;
+   }
+};
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -1881,6 +1881,22 @@ inline void eval_lcm(gmp_int& result, const gmp_int& a, const gmp_int& b)
 {
    mpz_lcm(result.data(), a.data(), b.data());
 }
+inline void eval_gcdext(gmp_int& g, gmp_int& s, gmp_int& t, const gmp_int& a, const gmp_int& b)
+{
+   mpz_gcdext(g.data(), s.data(), t.data(), a.data(), b.data());
+}
+inline bool eval_invert_mod(gmp_int& result, const gmp_int& a, const gmp_int& m)
+{
+   if (mpz_cmpabs_ui(m.data(), 1) <= 0)
+   {
+      // mpz_invert is undefined for zero, and not consistent between versions for +-1:
+      if (mpz_sgn(m.data()) == 0)
+         return false;
+      mpz_set_ui(result.data(), 0);
+      return true;
+   }
+   return mpz_invert(result.data(), a.data(), m.data()) != 0;
+}
 template <class I>
 inline typename enable_if_c<(is_unsigned<I>::value && (sizeof(I) <= sizeof(unsigned long)))>::type eval_gcd(gmp_int& result, const gmp_int& a, const I b)
 {
@@ -1907,6 +1923,21 @@ inline void eval_integer_sqrt(gmp_int& s, gmp_int& r, const gmp_int& x)
    mpz_sqrtrem(s.data(), r.data(), x.data());
 }
 
+inline void eval_integer_root(gmp_int& result, const gmp_int& x, unsigned k)
+{
+   mpz_root(result.data(), x.data(), k);
+}
+
+inline bool eval_is_perfect_square(const gmp_int& x)
+{
+   return mpz_perfect_square_p(x.data()) != 0;
+}
+
+inline bool eval_is_perfect_power(const gmp_int& x)
+{
+   return mpz_perfect_power_p(x.data()) != 0;
+}
+
 inline unsigned eval_lsb(const gmp_int& val)
 {
    int c = eval_get_sign(val);
@@ -0,0 +1,272 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Fibonacci and Lucas numbers, and the n'th term of a general linear recurrence,
+// optionally modulo some value.  Each needs O(log n) multiplications: Fibonacci
+// and Lucas numbers by the doubling formulae, which need just two squarings per
+// bit of n, and general recurrences of order d by computing x^n modulo the
+// characteristic polynomial (Fiduccia's method), which is the matrix power
+// method in O(d^2) rather than O(d^3) operations per bit.  The modular versions
+// work in mod_int, so that odd moduli get Montgomery multiplication.
+//
+#ifndef BOOST_MP_LINEAR_RECURRENCE_HPP
+#define BOOST_MP_LINEAR_RECURRENCE_HPP
+
+#include <boost/multiprecision/integer.hpp>
+#include <boost/multiprecision/modular_adaptor.hpp>
+#include <vector>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+template <class N>
+inline typename enable_if_c<is_unsigned<N>::value, bool>::type is_negative_index(const N&) { return false; }
+template <class N>
+inline typename disable_if_c<is_unsigned<N>::value, bool>::type is_negative_index(const N& n) { return n < 0; }
+
+template <class N>
+inline typename enable_if_c<is_integral<N>::value, std::size_t>::type recurrence_small_index(const N& n) { return static_cast<std::size_t>(n); }
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::size_t recurrence_small_index(const number<Backend, ExpressionTemplates>& n) { return n.template convert_to<std::size_t>(); }
+
+//
+// On entry a = F(1) = 1 and b = F(0) = 0, on exit a = F(n) and b = F(n-1) for n > 0.  With
+// a = F(k) and b = F(k-1) we use:
+//
+// F(2k+1) = 4F(k)^2 - F(k-1)^2 + 2(-1)^k
+// F(2k-1) = F(k)^2 + F(k-1)^2
+// F(2k)   = F(2k+1) - F(2k-1)
+//
+// Every intermediate value is non-negative, so unsigned types are fine:
+//
+template <class T, class N>
+void fibonacci_imp(T& a, T& b, const N& n)
+{
+   using std::swap;
+   T        a2, b2;
+   bool     odd = true;
+   unsigned i   = msb(n);
+   while (i--)
+   {
+      a2 = a * a;
+      b2 = b * b;
+      a  = a2 * 4;
+      a -= b2;
+      if (odd)
+         a -= 2;
+      else
+         a += 2;
+      b2 += a2;
+      // a = F(2k+1), b2 = F(2k-1):
+      odd = bit_test(n, i);
+      if (odd)
+      {
+         b = a;
+         b -= b2;
+      }
+      else
+      {
+         a -= b2;
+         swap(b, b2);
+      }
+   }
+}
+
+//
+// Sets r to r * r modulo the characteristic polynomial x^d - c[0]x^(d-1) - ... - c[d-1],
+// using t as workspace:
+//
+template <class T>
+void recurrence_square(std::vector<T>& r, std::vector<T>& t, const std::vector<T>& c, const T& zero)
+{
+   using std::swap;
+   std::size_t d = c.size();
+   t.assign(2 * d - 1, zero);
+   for (std::size_t i = 0; i < d; ++i)
+   {
+      for (std::size_t j = i + 1; j < d; ++j)
+         t[i + j] += r[i] * r[j];
+   }
+   for (std::size_t i = 0; i < 2 * d - 1; ++i)
+      t[i] *= 2;
+   for (std::size_t i = 0; i < d; ++i)
+      t[2 * i] += r[i] * r[i];
+   //
+   // x^k = x^(k-d) (c[0]x^(d-1) + ... + c[d-1]) for k >= d:
+   //
+   for (std::size_t k = 2 * d - 1; k-- > d;)
+   {
+      for (std::size_t j = 0; j < d; ++j)
+         t[k - 1 - j] += t[k] * c[j];
+   }
+   for (std::size_t i = 0; i < d; ++i)
+      swap(r[i], t[i]);
+}
+//
+// Sets r to x * r modulo the characteristic polynomial:
+//
+template <class T>
+void recurrence_multiply_x(std::vector<T>& r, const std::vector<T>& c)
+{
+   using std::swap;
+   std::size_t d = c.size();
+   T           top;
+   swap(top, r[d - 1]);
+   for (std::size_t i = d - 1; i > 0; --i)
+      swap(r[i], r[i - 1]);
+   r[0] = top * c[d - 1];
+   for (std::size_t j = 0; j + 1 < d; ++j)
+      r[d - 1 - j] += top * c[j];
+}
+
+template <class T, class N>
+void linear_recurrence_imp(T& result, const std::vector<T>& c, const std::vector<T>& init, const N& n, const T& zero)
+{
+   std::size_t d = c.size();
+   if (n < static_cast<N>(d))
+   {
+      result = init[recurrence_small_index(n)];
+      return;
+   }
+   //
+   // With x^n = r[0] + r[1]x + ... + r[d-1]x^(d-1) modulo the characteristic polynomial,
+   // the n'th term is r[0]a[0] + r[1]a[1] + ... + r[d-1]a[d-1]:
+   //
+   std::vector<T> r(d, zero), t;
+   r[0] = 1u;
+   for (unsigned i = msb(n) + 1; i-- > 0;)
+   {
+      recurrence_square(r, t, c, zero);
+      if (bit_test(n, i))
+         recurrence_multiply_x(r, c);
+   }
+   result = zero;
+   for (std::size_t i = 0; i < d; ++i)
+      result += r[i] * init[i];
+}
+
+template <class N>
+inline void check_recurrence_index(const N& n)
+{
+   if (is_negative_index(n))
+      BOOST_THROW_EXCEPTION(std::domain_error("The index of a recurrence must not be negative."));
+}
+
+template <class T>
+inline void check_recurrence_args(const std::vector<T>& coeffs, const std::vector<T>& init)
+{
+   if (coeffs.empty() || (coeffs.size() != init.size()))
+      BOOST_THROW_EXCEPTION(std::domain_error("A linear recurrence requires at least one coefficient, and as many initial values as coefficients."));
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline number<modular_adaptor<Backend>, ExpressionTemplates> make_residue(const number<Backend, ExpressionTemplates>& x, const modular_params<Backend>& p)
+{
+   number<modular_adaptor<Backend>, ExpressionTemplates> result(p);
+   result.backend() = modular_adaptor<Backend>(x.backend(), p);
+   return result;
+}
+
+} // namespace detail
+
+//
+// Returns the Fibonacci number F(n) and the Lucas number L(n) = F(n-1) + F(n+1),
+// where n may be any integer type:
+//
+template <class Integer, class N>
+Integer fibonacci(const N& n)
+{
+   detail::check_recurrence_index(n);
+   Integer a(1u), b(0u);
+   if (n == 0)
+      return b;
+   detail::fibonacci_imp(a, b, n);
+   return a;
+}
+
+template <class Integer, class N>
+Integer lucas(const N& n)
+{
+   detail::check_recurrence_index(n);
+   Integer a(1u), b(0u);
+   if (n == 0)
+      return Integer(2u);
+   detail::fibonacci_imp(a, b, n);
+   a += b;
+   a += b;
+   return a;
+}
+//
+// Returns the n'th term of a[k] = coeffs[0]a[k-1] + coeffs[1]a[k-2] + ... + coeffs[d-1]a[k-d],
+// where the first d terms are init[0], ..., init[d-1]:
+//
+template <class Integer, class N>
+Integer linear_recurrence_nth(const std::vector<Integer>& coeffs, const std::vector<Integer>& init, const N& n)
+{
+   detail::check_recurrence_index(n);
+   detail::check_recurrence_args(coeffs, init);
+   Integer result, zero(0u);
+   detail::linear_recurrence_imp(result, coeffs, init, n, zero);
+   return result;
+}
+
+//
+// As above, but modulo m > 0, returning a value in [0, m):
+//
+template <class Backend, expression_template_option ExpressionTemplates, class N>
+number<Backend, ExpressionTemplates> fibonacci(const N& n, const number<Backend, ExpressionTemplates>& m)
+{
+   typedef number<modular_adaptor<Backend>, ExpressionTemplates> mod_type;
+   detail::check_recurrence_index(n);
+   modular_params<Backend> p(m);
+   mod_type                a(p), b(p);
+   if (n == 0)
+      return residue(b);
+   a = 1u;
+   detail::fibonacci_imp(a, b, n);
+   return residue(a);
+}
+
+template <class Backend, expression_template_option ExpressionTemplates, class N>
+number<Backend, ExpressionTemplates> lucas(const N& n, const number<Backend, ExpressionTemplates>& m)
+{
+   typedef number<modular_adaptor<Backend>, ExpressionTemplates> mod_type;
+   detail::check_recurrence_index(n);
+   modular_params<Backend> p(m);
+   mod_type                a(p), b(p);
+   a = 1u;
+   if (n == 0)
+      a = 2u;
+   else
+   {
+      detail::fibonacci_imp(a, b, n);
+      a += b;
+      a += b;
+   }
+   return residue(a);
+}
+
+template <class Backend, expression_template_option ExpressionTemplates, class N>
+number<Backend, ExpressionTemplates> linear_recurrence_nth(const std::vector<number<Backend, ExpressionTemplates> >& coeffs, const std::vector<number<Backend, ExpressionTemplates> >& init, const N& n, const number<Backend, ExpressionTemplates>& m)
+{
+   typedef number<modular_adaptor<Backend>, ExpressionTemplates> mod_type;
+   detail::check_recurrence_index(n);
+   detail::check_recurrence_args(coeffs, init);
+   modular_params<Backend> p(m);
+   std::vector<mod_type>   mc, mi;
+   for (std::size_t i = 0; i < coeffs.size(); ++i)
+   {
+      mc.push_back(detail::make_residue(coeffs[i], p));
+      mi.push_back(detail::make_residue(init[i], p));
+   }
+   mod_type result(p), zero(p);
+   detail::linear_recurrence_imp(result, mc, mi, n, zero);
+   return residue(result);
+}
+
+}} // namespace boost::multiprecision
+
+#endif
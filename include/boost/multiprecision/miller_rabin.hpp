@@ -129,39 +129,307 @@ cast_to_unsigned(const I& val)
    return val.template convert_to<unsigned>();
 }
 
-} // namespace detail
+//
+// Returns a * b mod n for a, b < n, forming the product at double width so that
+// fixed precision and built in types don't overflow:
+//
+template <class I>
+typename enable_if_c<is_integral<I>::value, I>::type
+mul_mod(const I& a, const I& b, const I& n)
+{
+   typename double_integer<I>::type result;
+   multiply(result, a, b);
+   return static_cast<I>(result % n);
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+number<Backend, ExpressionTemplates>
+mul_mod(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b, const number<Backend, ExpressionTemplates>& n)
+{
+   typedef number<typename default_ops::double_precision_type<Backend>::type, ExpressionTemplates> double_type;
+   double_type result(a);
+   result *= double_type(b);
+   result %= double_type(n);
+   return static_cast<number<Backend, ExpressionTemplates> >(result);
+}
+//
+// Arithmetic modulo n for the Lucas test, on values in an internal form in which 0 is
+// represented by 0 and halving works as for ordinary residues.  This one works on the
+// residues themselves, and never forms a value of n or more:
+//
+template <class I>
+class lucas_modular_context
+{
+   I m_modulus;
 
-template <class I, class Engine>
-typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
-miller_rabin_test(const I& n, unsigned trials, Engine& gen)
+ public:
+   explicit lucas_modular_context(const I& n) : m_modulus(n) {}
+
+   void to_internal(I& r, const I& a) const { r = a; }
+   void multiply(I& r, const I& a, const I& b) const { r = mul_mod(a, b, m_modulus); }
+   void add(I& r, const I& a) const
+   {
+      I t = m_modulus - a;
+      r   = r >= t ? I(r - t) : I(r + a);
+   }
+   void subtract(I& r, const I& a) const
+   {
+      r = r >= a ? I(r - a) : I(r + I(m_modulus - a));
+   }
+};
+//
+// a / 2 mod n for odd n:
+//
+template <class I>
+void half_mod(I& a, const I& n)
+{
+   if (bit_test(a, 0))
+   {
+      a >>= 1;
+      a += n >> 1;
+      ++a;
+   }
+   else
+      a >>= 1;
+}
+//
+// The Jacobi symbol (a/m) for odd m > 0:
+//
+inline int jacobi_symbol(unsigned a, unsigned m)
+{
+   int result = 1;
+   a %= m;
+   while (a)
+   {
+      while (!(a & 1u))
+      {
+         a >>= 1;
+         if (((m & 7u) == 3u) || ((m & 7u) == 5u))
+            result = -result;
+      }
+      std::swap(a, m);
+      if (((a & 3u) == 3u) && ((m & 3u) == 3u))
+         result = -result;
+      a %= m;
+   }
+   return m == 1 ? result : 0;
+}
+//
+// The strong Lucas probable prime test with Selfridge's parameters: D is the first of
+// 5, -7, 9, -11, ... with (D/n) = -1, P = 1 and Q = (1 - D) / 4.  n must be odd, greater
+// than 227 and not a perfect square.  See R. Baillie and S. S. Wagstaff, "Lucas
+// Pseudoprimes", Math. Comp. 35 (1980).  Context provides the arithmetic modulo n:
+//
+template <class Context, class I>
+bool strong_lucas_test(const I& n)
+{
+   unsigned d_abs = 5;
+   bool     d_neg = false;
+   while (true)
+   {
+      //
+      // (D/n) = (n/|D|) by quadratic reciprocity, as |D| = 1 mod 4 whenever D > 0,
+      // times (-1/n) when D < 0:
+      //
+      unsigned n_mod_4 = integer_modulus(n, 4u);
+      int      j       = jacobi_symbol(integer_modulus(n, d_abs), d_abs);
+      if (((d_abs & 3u) == 3u) && (n_mod_4 == 3u))
+         j = -j;
+      if (d_neg && (n_mod_4 == 3u))
+         j = -j;
+      if (j == -1)
+         break;
+      if ((j == 0) && (n > d_abs))
+         return false;
+      d_abs += 2;
+      d_neg = !d_neg;
+      if (d_abs == 21)
+      {
+         //
+         // No such D exists for perfect squares, so check before searching further:
+         //
+         I r;
+         sqrt(n, r);
+         if (r == 0)
+            return false;
+      }
+   }
+   //
+   // Residues of D and Q = (1 - D) / 4 modulo n:
+   //
+   I d_res = d_neg ? I(n - d_abs) : I(d_abs);
+   I q_res = d_neg ? I((d_abs + 1) / 4) : I(n - (d_abs - 1) / 4);
+   //
+   // n + 1 = d * 2^s with d odd, taking care not to overflow n + 1:
+   //
+   I        d = n >> 1;
+   unsigned s = 1;
+   ++d;
+   unsigned z = lsb(d);
+   d >>= z;
+   s += z;
+   using std::swap;
+   Context ctx(n);
+   //
+   // Left to right evaluation of U_d, V_d and Q^d, starting from U_1 = 1, V_1 = P = 1:
+   //
+   I u, v, qk, t, dk, qd;
+   ctx.to_internal(u, I(1));
+   v = u;
+   ctx.to_internal(dk, d_res);
+   ctx.to_internal(qd, q_res);
+   qk = qd;
+   for (unsigned i = msb(d); i > 0; --i)
+   {
+      // U_2k = U_k V_k, V_2k = V_k^2 - 2Q^k, Q^2k = (Q^k)^2:
+      ctx.multiply(t, u, v);
+      swap(u, t);
+      ctx.multiply(t, v, v);
+      swap(v, t);
+      ctx.subtract(v, qk);
+      ctx.subtract(v, qk);
+      ctx.multiply(t, qk, qk);
+      swap(qk, t);
+      if (bit_test(d, i - 1))
+      {
+         // U_2k+1 = (P U_2k + V_2k) / 2, V_2k+1 = (D U_2k + P V_2k) / 2:
+         ctx.multiply(t, dk, u);
+         ctx.add(t, v);
+         half_mod(t, n);
+         ctx.add(u, v);
+         half_mod(u, n);
+         swap(v, t);
+         ctx.multiply(t, qk, qd);
+         swap(qk, t);
+      }
+   }
+   if ((u == 0) || (v == 0))
+      return true;
+   for (unsigned r = 1; r < s; ++r)
+   {
+      ctx.multiply(t, v, v);
+      swap(v, t);
+      ctx.subtract(v, qk);
+      ctx.subtract(v, qk);
+      if (v == 0)
+         return true;
+      ctx.multiply(t, qk, qk);
+      swap(qk, t);
+   }
+   return false;
+}
+
+//
+// The part of the Miller-Rabin test which doesn't depend on the random witnesses:
+// trial division and a single Fermat test, which excludes a lot of candidates.
+// Returns 1 if n is prime, -1 if it is composite and 0 if we can't yet tell:
+//
+template <class I>
+int miller_rabin_screen(const I& n)
+{
+   typedef I number_type;
+
+   if (n == 2)
+      return 1; // Trivial special case.
+   if (bit_test(n, 0) == 0)
+      return -1; // n is even
+   if (n <= 227)
+      return detail::is_small_prime(detail::cast_to_unsigned(n)) ? 1 : -1;
+
+   if (!detail::check_small_factors(n))
+      return -1;
+
+   //
+   // A single Fermat test - it excludes a lot of candidates:
+   //
+   number_type q(228), nm1 = n - 1; // We know n is greater than q, as we've excluded small factors
+   return powm(q, nm1, n) != 1u ? -1 : 0;
+}
+//
+// Returns true if n is a strong probable prime to base x, where n - 1 = q 2^k with q odd:
+//
+template <class I>
+bool miller_rabin_witness(const I& n, const I& nm1, const I& q, unsigned k, const I& x)
 {
 #ifdef BOOST_MSVC
 #pragma warning(push)
 #pragma warning(disable : 4127)
 #endif
+   I        y = powm(x, q, n);
+   unsigned j = 0;
+   while (true)
+   {
+      if (y == nm1)
+         return true;
+      if (y == 1)
+         return j == 0;
+      if (++j == k)
+         return false; // failed
+      y = powm(y, 2, n);
+   }
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+}
+
+//
+// The Baillie-PSW test: trial division, a strong probable prime test to base 2 and a
+// strong Lucas test, whose arithmetic modulo n is done by Context:
+//
+template <class Context, class I>
+bool baillie_psw_test(const I& n)
+{
    typedef I number_type;
 
    if (n == 2)
       return true; // Trivial special case.
-   if (bit_test(n, 0) == 0)
-      return false; // n is even
+   if ((n < 2) || (bit_test(n, 0) == 0))
+      return false; // n is even, or too small
    if (n <= 227)
-      return detail::is_small_prime(detail::cast_to_unsigned(n));
+      return is_small_prime(cast_to_unsigned(n));
 
-   if (!detail::check_small_factors(n))
+   if (!check_small_factors(n))
       return false;
-
-   number_type nm1 = n - 1;
+   if (n < 229u * 229u)
+      return true; // no factors up to sqrt(n)
    //
-   // Begin with a single Fermat test - it excludes a lot of candidates:
+   // Strong test to base 2:
    //
-   number_type q(228), x, y; // We know n is greater than this, as we've excluded small factors
-   x = powm(q, nm1, n);
-   if (x != 1u)
-      return false;
+   number_type nm1 = n - 1;
+   number_type q   = nm1;
+   unsigned    k   = lsb(q);
+   q >>= k;
+   number_type y = powm(number_type(2), q, n);
+   if ((y != 1) && (y != nm1))
+   {
+      unsigned j = 1;
+      for (; j < k; ++j)
+      {
+         y = powm(y, 2, n);
+         if (y == nm1)
+            break;
+         if (y == 1)
+            return false;
+      }
+      if (j == k)
+         return false;
+   }
+   return strong_lucas_test<Context>(n);
+}
+
+} // namespace detail
 
-   q          = n - 1;
-   unsigned k = lsb(q);
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
+miller_rabin_test(const I& n, unsigned trials, Engine& gen)
+{
+   typedef I number_type;
+
+   int screen = detail::miller_rabin_screen(n);
+   if (screen)
+      return screen > 0;
+
+   number_type nm1 = n - 1, q = nm1, x;
+   unsigned    k   = lsb(q);
    q >>= k;
 
    // Declare our random number generator:
@@ -171,28 +439,11 @@ miller_rabin_test(const I& n, unsigned trials, Engine& gen)
    //
    for (unsigned i = 0; i < trials; ++i)
    {
-      x          = dist(gen);
-      y          = powm(x, q, n);
-      unsigned j = 0;
-      while (true)
-      {
-         if (y == nm1)
-            break;
-         if (y == 1)
-         {
-            if (j == 0)
-               break;
-            return false; // test failed
-         }
-         if (++j == k)
-            return false; // failed
-         y = powm(y, 2, n);
-      }
+      x = dist(gen);
+      if (!detail::miller_rabin_witness(n, nm1, q, k, x))
+         return false; // test failed
    }
    return true; // Yeheh! probably prime.
-#ifdef BOOST_MSVC
-#pragma warning(pop)
-#endif
 }
 
 template <class I>
@@ -217,6 +468,24 @@ bool miller_rabin_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n,
    return miller_rabin_test(number_type(n), trials);
 }
 
+//
+// The Baillie-PSW test: trial division, a strong probable prime test to base 2 and a
+// strong Lucas test.  There are no known composites which pass, and none below 2^64:
+//
+template <class I>
+typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
+bpsw_test(const I& n)
+{
+   return detail::baillie_psw_test<detail::lucas_modular_context<I> >(n);
+}
+
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4>
+bool bpsw_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n)
+{
+   typedef typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type number_type;
+   return bpsw_test(number_type(n));
+}
+
 }} // namespace boost::multiprecision
 
 #endif
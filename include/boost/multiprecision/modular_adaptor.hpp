@@ -0,0 +1,739 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Arithmetic modulo a fixed n: values share a reference counted context
+// holding the modulus, and for odd moduli are kept in Montgomery form so
+// that multiplication needs no division.
+//
+#ifndef BOOST_MP_MODULAR_ADAPTOR_HPP
+#define BOOST_MP_MODULAR_ADAPTOR_HPP
+
+#include <boost/multiprecision/number.hpp>
+#include <boost/multiprecision/detail/integer_ops.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace boost {
+namespace multiprecision {
+namespace backends {
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4127) // conditional expression is constant
+#endif
+
+//
+// Montgomery reduction for an odd modulus n built from the backend's own arithmetic,
+// with R the smallest power of 2 greater than n: reduction modulo R and division by R
+// are masks and shifts.  Products are formed in the double precision type used by
+// eval_powm so that fixed precision backends do not overflow.  Backends with a faster
+// limb level implementation specialise this template:
+//
+template <class Backend>
+class montgomery_reducer
+{
+   typedef typename default_ops::double_precision_type<Backend>::type double_type;
+   typedef typename mpl::front<typename double_type::unsigned_types>::type ui_type;
+
+   double_type m_modulus, m_mask, m_inverse;
+   Backend     m_r2;
+   unsigned    m_bits;
+
+ public:
+   montgomery_reducer() : m_bits(0) {}
+   explicit montgomery_reducer(const Backend& n) : m_modulus(n)
+   {
+      using default_ops::eval_decrement;
+      using default_ops::eval_invert_mod;
+      using default_ops::eval_left_shift;
+      using default_ops::eval_modulus;
+      using default_ops::eval_msb;
+      using default_ops::eval_multiply;
+      using default_ops::eval_subtract;
+
+      m_bits = eval_msb(n) + 1;
+      double_type r, t;
+      r = ui_type(1u);
+      eval_left_shift(r, m_bits);
+      m_mask = r;
+      eval_decrement(m_mask);
+      //
+      // -1/n mod R:
+      //
+      eval_invert_mod(t, m_modulus, r);
+      eval_subtract(m_inverse, r, t);
+      //
+      // R^2 mod n, by way of R mod n as R^2 may not fit in double_type:
+      //
+      eval_modulus(t, r, m_modulus);
+      eval_multiply(r, t, t);
+      eval_modulus(t, r, m_modulus);
+      m_r2 = t;
+   }
+   //
+   // Conversions to and from Montgomery form, a must be less than n:
+   //
+   void to_montgomery(Backend& r, const Backend& a) const
+   {
+      multiply(r, a, m_r2);
+   }
+   void from_montgomery(Backend& r, const Backend& a) const
+   {
+      double_type t(a);
+      reduce(r, t);
+   }
+   void multiply(Backend& r, const Backend& a, const Backend& b) const
+   {
+      using default_ops::eval_multiply;
+      double_type t;
+      eval_multiply(t, a, b);
+      reduce(r, t);
+   }
+   void square(Backend& r, const Backend& a) const
+   {
+      multiply(r, a, a);
+   }
+
+ private:
+   //
+   // Sets r = t / R mod n for t < n * R.  Since t + m * n is divisible by R, the low parts
+   // of t and m * n sum to either 0 or R, so we can shift each right separately and add
+   // a carry: that way nothing ever exceeds 2 * log2(R) bits:
+   //
+   void reduce(Backend& r, double_type& t) const
+   {
+      using default_ops::eval_add;
+      using default_ops::eval_bitwise_and;
+      using default_ops::eval_increment;
+      using default_ops::eval_is_zero;
+      using default_ops::eval_multiply;
+      using default_ops::eval_right_shift;
+      using default_ops::eval_subtract;
+
+      double_type m, u;
+      eval_bitwise_and(m, t, m_mask);
+      bool carry = !eval_is_zero(m);
+      eval_multiply(u, m, m_inverse);
+      eval_bitwise_and(m, u, m_mask);
+      eval_multiply(u, m, m_modulus);
+      eval_right_shift(u, m_bits);
+      eval_right_shift(t, m_bits);
+      eval_add(t, u);
+      if (carry)
+         eval_increment(t);
+      if (t.compare(m_modulus) >= 0)
+         eval_subtract(t, m_modulus);
+      r = t;
+   }
+};
+
+//
+// The modulus and everything precomputed from it, shared by all values using that modulus.
+// Values are kept fully reduced, and in Montgomery form when the modulus is odd:
+//
+template <class Backend>
+class modular_context
+{
+   typedef typename mpl::front<typename Backend::unsigned_types>::type ui_type;
+
+   Backend                     m_modulus;
+   bool                        m_montgomery;
+   montgomery_reducer<Backend> m_reducer;
+
+   modular_context(const modular_context&);
+   modular_context& operator=(const modular_context&);
+
+ public:
+   explicit modular_context(const Backend& n) : m_modulus(n), m_montgomery(false)
+   {
+      using default_ops::eval_bit_test;
+      using default_ops::eval_get_sign;
+
+      if (eval_get_sign(n) <= 0)
+         BOOST_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+      if (eval_bit_test(n, 0))
+      {
+         m_reducer    = montgomery_reducer<Backend>(n);
+         m_montgomery = true;
+      }
+   }
+
+   const Backend& modulus() const { return m_modulus; }
+
+   //
+   // Sets r to the internal form of the integer a, which may be negative or out of range:
+   //
+   void to_internal(Backend& r, const Backend& a) const
+   {
+      using default_ops::eval_add;
+      using default_ops::eval_get_sign;
+      using default_ops::eval_modulus;
+
+      Backend t;
+      if ((eval_get_sign(a) < 0) || (a.compare(m_modulus) >= 0))
+      {
+         eval_modulus(t, a, m_modulus);
+         if (eval_get_sign(t) < 0)
+            eval_add(t, m_modulus);
+      }
+      else
+         t = a;
+      if (m_montgomery)
+         m_reducer.to_montgomery(r, t);
+      else
+         r.swap(t);
+   }
+   //
+   // Sets r to the residue in [0, n) represented by a:
+   //
+   void from_internal(Backend& r, const Backend& a) const
+   {
+      if (m_montgomery)
+         m_reducer.from_montgomery(r, a);
+      else
+         r = a;
+   }
+   void one(Backend& r) const
+   {
+      Backend t;
+      t = ui_type(1u);
+      to_internal(r, t);
+   }
+   //
+   // Addition and subtraction never form a value of n or more, so that n may use
+   // every bit of a fixed precision type:
+   //
+   void add(Backend& r, const Backend& a) const
+   {
+      using default_ops::eval_add;
+      using default_ops::eval_subtract;
+      Backend t(m_modulus);
+      eval_subtract(t, a);
+      if (r.compare(t) >= 0)
+         eval_subtract(r, t);
+      else
+         eval_add(r, a);
+   }
+   void subtract(Backend& r, const Backend& a) const
+   {
+      using default_ops::eval_add;
+      using default_ops::eval_subtract;
+      if (r.compare(a) < 0)
+      {
+         Backend t(m_modulus);
+         eval_subtract(t, a);
+         eval_add(r, t);
+      }
+      else
+         eval_subtract(r, a);
+   }
+   void negate(Backend& r) const
+   {
+      using default_ops::eval_is_zero;
+      using default_ops::eval_subtract;
+      if (!eval_is_zero(r))
+      {
+         Backend t(m_modulus);
+         eval_subtract(t, r);
+         r.swap(t);
+      }
+   }
+   void multiply(Backend& r, const Backend& a, const Backend& b) const
+   {
+      using default_ops::eval_modulus;
+      using default_ops::eval_multiply;
+      if (m_montgomery)
+         m_reducer.multiply(r, a, b);
+      else
+      {
+         typename default_ops::double_precision_type<Backend>::type t;
+         eval_multiply(t, a, b);
+         eval_modulus(t, m_modulus);
+         r = t;
+      }
+   }
+   void square(Backend& r, const Backend& a) const
+   {
+      if (m_montgomery)
+         m_reducer.square(r, a);
+      else
+         multiply(r, a, a);
+   }
+   //
+   // Sets r to the inverse of a and returns true, or returns false if there is no inverse:
+   //
+   bool invert(Backend& r, const Backend& a) const
+   {
+      using default_ops::eval_invert_mod;
+      Backend t, u;
+      from_internal(t, a);
+      if (!eval_invert_mod(u, t, m_modulus))
+         return false;
+      to_internal(r, u);
+      return true;
+   }
+   //
+   // Sets r = a^p for p >= 0 by left to right sliding window exponentiation:
+   //
+   void pow(Backend& r, const Backend& a, const Backend& p) const
+   {
+      using default_ops::eval_bit_test;
+      using default_ops::eval_is_zero;
+      using default_ops::eval_msb;
+
+      if (eval_is_zero(p))
+      {
+         one(r);
+         return;
+      }
+      unsigned bits = eval_msb(p) + 1;
+      unsigned w    = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 1;
+      //
+      // Odd powers a, a^3, ..., a^(2^w - 1):
+      //
+      std::vector<Backend> table(static_cast<std::size_t>(1u) << (w - 1));
+      table[0] = a;
+      if (w > 1)
+      {
+         Backend a2;
+         square(a2, a);
+         for (std::size_t k = 1; k < table.size(); ++k)
+            multiply(table[k], table[k - 1], a2);
+      }
+      Backend x, t;
+      bool    started = false;
+      int     i       = static_cast<int>(bits) - 1;
+      while (i >= 0)
+      {
+         if (!eval_bit_test(p, i))
+         {
+            square(t, x);
+            x.swap(t);
+            --i;
+            continue;
+         }
+         int l = (std::max)(i - static_cast<int>(w) + 1, 0);
+         while (!eval_bit_test(p, l))
+            ++l;
+         unsigned value = 0;
+         for (int k = i; k >= l; --k)
+            value = (value << 1) | static_cast<unsigned>(eval_bit_test(p, k));
+         if (started)
+         {
+            for (int k = i; k >= l; --k)
+            {
+               square(t, x);
+               x.swap(t);
+            }
+            multiply(t, x, table[value >> 1]);
+            x.swap(t);
+         }
+         else
+         {
+            x       = table[value >> 1];
+            started = true;
+         }
+         i = l - 1;
+      }
+      r.swap(x);
+   }
+};
+
+//
+// A handle to a shared modular_context, cheap to copy:
+//
+template <class Backend>
+class modular_params
+{
+   boost::shared_ptr<const modular_context<Backend> > m_context;
+
+ public:
+   modular_params() {}
+   explicit modular_params(const Backend& n) : m_context(new modular_context<Backend>(n)) {}
+   template <expression_template_option ExpressionTemplates>
+   explicit modular_params(const number<Backend, ExpressionTemplates>& n) : m_context(new modular_context<Backend>(n.backend())) {}
+   template <class I>
+   explicit modular_params(const I& n, typename enable_if_c<is_integral<I>::value>::type* = 0)
+   {
+      typedef typename boost::multiprecision::detail::canonical<I, Backend>::type i_type;
+      Backend                                                                       t;
+      t = static_cast<i_type>(n);
+      m_context.reset(new modular_context<Backend>(t));
+   }
+
+   bool                            empty() const { return !m_context; }
+   const modular_context<Backend>& context() const { return *m_context; }
+   const Backend&                  modulus() const { return m_context->modulus(); }
+
+   //
+   // True if the two refer to the same modulus, whether or not they share a context:
+   //
+   bool same_modulus(const modular_params& o) const
+   {
+      return (m_context == o.m_context) || (m_context && o.m_context && (modulus().compare(o.modulus()) == 0));
+   }
+   void swap(modular_params& o) { m_context.swap(o.m_context); }
+};
+
+//
+// Holds either a residue modulo the modulus in m_params, in that context's internal form,
+// or, when m_params is empty, a plain integer.  Plain integers take on the modulus of
+// whatever they are combined with, so that mixed arithmetic with integer literals works:
+//
+template <class Backend>
+class modular_adaptor
+{
+ public:
+   typedef typename Backend::signed_types   signed_types;
+   typedef typename Backend::unsigned_types unsigned_types;
+   typedef typename Backend::float_types    float_types;
+   typedef modular_params<Backend>          params_type;
+
+ private:
+   Backend     m_value;
+   params_type m_params;
+
+ public:
+   modular_adaptor() {}
+   modular_adaptor(const modular_adaptor& o) : m_value(o.m_value), m_params(o.m_params) {}
+   modular_adaptor(const Backend& val) : m_value(val) {}
+   template <class T>
+   modular_adaptor(const T& i, const typename enable_if_c<is_convertible<T, Backend>::value>::type* = 0) : m_value(i) {}
+   explicit modular_adaptor(const params_type& p) : m_params(p) {}
+   modular_adaptor(const Backend& val, const params_type& p) : m_params(p)
+   {
+      p.context().to_internal(m_value, val);
+   }
+
+   modular_adaptor& operator=(const modular_adaptor& o)
+   {
+      m_value  = o.m_value;
+      m_params = o.m_params;
+      return *this;
+   }
+   //
+   // Assigning a plain value keeps the modulus, if there is one:
+   //
+   template <class T>
+   typename enable_if_c<is_arithmetic<T>::value || is_convertible<T, Backend>::value, modular_adaptor&>::type operator=(const T& i)
+   {
+      Backend t;
+      t = i;
+      assign_value(t);
+      return *this;
+   }
+   modular_adaptor& operator=(const char* s)
+   {
+      Backend t;
+      t = s;
+      assign_value(t);
+      return *this;
+   }
+   void swap(modular_adaptor& o)
+   {
+      m_value.swap(o.m_value);
+      m_params.swap(o.m_params);
+   }
+   std::string str(std::streamsize digits, std::ios_base::fmtflags f) const
+   {
+      if (m_params.empty())
+         return m_value.str(digits, f);
+      Backend t;
+      m_params.context().from_internal(t, m_value);
+      return t.str(digits, f);
+   }
+   void negate()
+   {
+      if (m_params.empty())
+         m_value.negate();
+      else
+         m_params.context().negate(m_value);
+   }
+   int compare(const modular_adaptor& o) const
+   {
+      if (!m_params.empty() && (m_params.same_modulus(o.m_params)) && (m_value.compare(o.m_value) == 0))
+         return 0;
+      Backend a, b;
+      residue(a);
+      o.residue(b);
+      return a.compare(b);
+   }
+   template <class T>
+   int compare(const T& i) const
+   {
+      if (m_params.empty())
+         return m_value.compare(i);
+      Backend t;
+      residue(t);
+      return t.compare(i);
+   }
+
+   bool               has_modulus() const { return !m_params.empty(); }
+   const params_type& params() const { return m_params; }
+   Backend&           value() { return m_value; }
+   const Backend&     value() const { return m_value; }
+   //
+   // Sets r to the value as a plain integer:
+   //
+   void residue(Backend& r) const
+   {
+      if (m_params.empty())
+         r = m_value;
+      else
+         m_params.context().from_internal(r, m_value);
+   }
+   //
+   // Converts a plain integer value to the internal form of p:
+   //
+   void adopt(const params_type& p)
+   {
+      BOOST_ASSERT(m_params.empty());
+      Backend t;
+      p.context().to_internal(t, m_value);
+      m_value.swap(t);
+      m_params = p;
+   }
+#ifndef BOOST_NO_CXX11_EXPLICIT_CONVERSION_OPERATORS
+   explicit operator Backend() const
+   {
+      Backend t;
+      residue(t);
+      return t;
+   }
+#endif
+
+ private:
+   void assign_value(const Backend& t)
+   {
+      if (m_params.empty())
+         m_value = t;
+      else
+         m_params.context().to_internal(m_value, t);
+   }
+};
+
+//
+// Returns the value of a in the internal form of result's modulus, giving result the
+// modulus of a if it has none.  At least one of the two must have a modulus:
+//
+template <class Backend>
+inline const Backend& modular_operand(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& a, Backend& t)
+{
+   if (!a.has_modulus())
+   {
+      result.params().context().to_internal(t, a.value());
+      return t;
+   }
+   if (!result.has_modulus())
+      result.adopt(a.params());
+   else if (!result.params().same_modulus(a.params()))
+      BOOST_THROW_EXCEPTION(std::domain_error("Arithmetic on values with different moduli."));
+   return a.value();
+}
+
+template <class Backend>
+inline void eval_add(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& a)
+{
+   using default_ops::eval_add;
+   if (!result.has_modulus() && !a.has_modulus())
+   {
+      eval_add(result.value(), a.value());
+      return;
+   }
+   Backend        t;
+   const Backend& v = modular_operand(result, a, t);
+   result.params().context().add(result.value(), v);
+}
+
+template <class Backend>
+inline void eval_subtract(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& a)
+{
+   using default_ops::eval_subtract;
+   if (!result.has_modulus() && !a.has_modulus())
+   {
+      eval_subtract(result.value(), a.value());
+      return;
+   }
+   Backend        t;
+   const Backend& v = modular_operand(result, a, t);
+   result.params().context().subtract(result.value(), v);
+}
+
+template <class Backend>
+inline void eval_multiply(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& a)
+{
+   using default_ops::eval_multiply;
+   if (!result.has_modulus() && !a.has_modulus())
+   {
+      eval_multiply(result.value(), a.value());
+      return;
+   }
+   Backend        t, r;
+   const Backend& v = modular_operand(result, a, t);
+   result.params().context().multiply(r, result.value(), v);
+   result.value().swap(r);
+}
+
+//
+// Division is multiplication by the inverse, which must exist:
+//
+template <class Backend>
+inline void eval_divide(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& a)
+{
+   using default_ops::eval_divide;
+   if (!result.has_modulus() && !a.has_modulus())
+   {
+      eval_divide(result.value(), a.value());
+      return;
+   }
+   Backend        t, r;
+   const Backend& v = modular_operand(result, a, t);
+   if (!result.params().context().invert(r, v))
+      BOOST_THROW_EXCEPTION(std::domain_error("Division by a value with no inverse modulo the modulus."));
+   result.params().context().multiply(t, result.value(), r);
+   result.value().swap(t);
+}
+
+template <class Backend, class U>
+inline typename enable_if_c<is_integral<U>::value>::type eval_pow(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& a, const U& p)
+{
+   typedef typename boost::multiprecision::detail::canonical<typename make_unsigned<U>::type, Backend>::type ui_type;
+
+   if (!a.has_modulus())
+   {
+      using default_ops::eval_pow;
+      Backend t;
+      eval_pow(t, a.value(), p);
+      result = t;
+      return;
+   }
+   const modular_context<Backend>& ctx = a.params().context();
+   Backend                         x, e;
+   if (p < 0)
+   {
+      if (!ctx.invert(x, a.value()))
+         BOOST_THROW_EXCEPTION(std::domain_error("Negative power of a value with no inverse modulo the modulus."));
+      e = static_cast<ui_type>(static_cast<typename make_unsigned<U>::type>(0u) - static_cast<typename make_unsigned<U>::type>(p));
+   }
+   else
+   {
+      x = a.value();
+      e = static_cast<ui_type>(p);
+   }
+   modular_adaptor<Backend> r(a.params());
+   ctx.pow(r.value(), x, e);
+   result.swap(r);
+}
+
+template <class Backend>
+inline bool eval_is_zero(const modular_adaptor<Backend>& val)
+{
+   using default_ops::eval_is_zero;
+   return eval_is_zero(val.value());
+}
+
+template <class Backend>
+inline int eval_get_sign(const modular_adaptor<Backend>& val)
+{
+   using default_ops::eval_get_sign;
+   return eval_get_sign(val.value());
+}
+
+template <class R, class Backend>
+inline void eval_convert_to(R* result, const modular_adaptor<Backend>& val)
+{
+   using default_ops::eval_convert_to;
+   Backend t;
+   val.residue(t);
+   eval_convert_to(result, t);
+}
+
+template <class Backend, class V, class U>
+inline void assign_components(modular_adaptor<Backend>& result, const V& v, const U& n)
+{
+   Backend a, m;
+   a = v;
+   m = n;
+   modular_params<Backend>  p(m);
+   modular_adaptor<Backend> t(a, p);
+   result.swap(t);
+}
+
+template <class Backend>
+inline std::size_t hash_value(const modular_adaptor<Backend>& val)
+{
+   Backend t;
+   val.residue(t);
+   return hash_value(t);
+}
+
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+} // namespace backends
+
+using backends::modular_adaptor;
+using backends::modular_params;
+
+#ifndef BOOST_NO_CXX11_TEMPLATE_ALIASES
+template <class Backend, expression_template_option ExpressionTemplates = expression_template_default<Backend>::value>
+using mod_int = number<modular_adaptor<Backend>, ExpressionTemplates>;
+#endif
+
+template <class Backend>
+struct number_category<backends::modular_adaptor<Backend> > : public mpl::int_<number_kind_integer>
+{};
+
+template <class Backend, expression_template_option ExpressionTemplates>
+struct component_type<number<backends::modular_adaptor<Backend>, ExpressionTemplates> >
+{
+   typedef number<Backend, ExpressionTemplates> type;
+};
+
+//
+// Large powers, inverses, and the modulus and plain value of a modular number:
+//
+template <class Backend, expression_template_option ExpressionTemplates, expression_template_option ExpressionTemplates2>
+inline number<modular_adaptor<Backend>, ExpressionTemplates> pow(const number<modular_adaptor<Backend>, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates2>& p)
+{
+   using default_ops::eval_get_sign;
+   if (!a.backend().has_modulus() || (eval_get_sign(p.backend()) < 0))
+      BOOST_THROW_EXCEPTION(std::domain_error("pow requires a value with a modulus and a non-negative exponent."));
+   number<modular_adaptor<Backend>, ExpressionTemplates> result(a.backend().params());
+   a.backend().params().context().pow(result.backend().value(), a.backend().value(), p.backend());
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline number<modular_adaptor<Backend>, ExpressionTemplates> inverse(const number<modular_adaptor<Backend>, ExpressionTemplates>& a)
+{
+   if (!a.backend().has_modulus())
+      BOOST_THROW_EXCEPTION(std::domain_error("inverse requires a value with a modulus."));
+   number<modular_adaptor<Backend>, ExpressionTemplates> result(a.backend().params());
+   if (!a.backend().params().context().invert(result.backend().value(), a.backend().value()))
+      BOOST_THROW_EXCEPTION(std::domain_error("inverse requires a value coprime to the modulus."));
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline number<Backend, ExpressionTemplates> modulus(const number<modular_adaptor<Backend>, ExpressionTemplates>& a)
+{
+   if (!a.backend().has_modulus())
+      return number<Backend, ExpressionTemplates>();
+   return number<Backend, ExpressionTemplates>(a.backend().params().modulus());
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline number<Backend, ExpressionTemplates> residue(const number<modular_adaptor<Backend>, ExpressionTemplates>& a)
+{
+   number<Backend, ExpressionTemplates> result;
+   a.backend().residue(result.backend());
+   return result;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -0,0 +1,248 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Simultaneous multi-exponentiation prod(g_i^e_i) mod m, sharing the squarings
+// between all the terms.  For few terms we use Straus' interleaved windows
+// (Knuth, TAOCP vol 2, 4.6.3 exercise 39), for many Pippenger's bucket method:
+// N. Pippenger, "On the evaluation of powers and monomials", SIAM J. Comput. 9 (1980).
+//
+#ifndef BOOST_MP_MULTI_POWM_HPP
+#define BOOST_MP_MULTI_POWM_HPP
+
+#include <boost/multiprecision/modular_adaptor.hpp>
+#include <iterator>
+
+namespace boost {
+namespace multiprecision {
+namespace default_ops {
+
+namespace detail {
+
+//
+// Returns the w bit digit of e starting at bit position pos:
+//
+template <class Backend>
+inline unsigned multi_powm_digit(const Backend& e, unsigned pos, unsigned w)
+{
+   using default_ops::eval_bit_test;
+   unsigned d = 0;
+   for (unsigned i = w; i > 0; --i)
+      d = (d << 1) | static_cast<unsigned>(eval_bit_test(e, pos + i - 1));
+   return d;
+}
+
+//
+// Sets r *= a, where r_one records that r is (still) 1, so that we never multiply by it:
+//
+template <class Backend>
+inline void multi_powm_accumulate(const backends::modular_context<Backend>& ctx, Backend& r, bool& r_one, const Backend& a, Backend& t)
+{
+   if (r_one)
+   {
+      r     = a;
+      r_one = false;
+   }
+   else
+   {
+      ctx.multiply(t, r, a);
+      r.swap(t);
+   }
+}
+
+} // namespace detail
+
+//
+// Sets result = prod(bases[i]^exponents[i]) mod m for i in [0, k), with m > 0 and
+// all the exponents non-negative.  The result is in the range [0, m):
+//
+template <class Backend>
+void eval_multi_powm(Backend& result, const Backend* bases, const Backend* exponents, std::size_t k, const Backend& m)
+{
+   typedef typename mpl::front<typename Backend::unsigned_types>::type ui_type;
+
+   using default_ops::eval_add;
+   using default_ops::eval_get_sign;
+   using default_ops::eval_is_zero;
+   using default_ops::eval_msb;
+   using default_ops::eval_powm;
+
+   if (eval_get_sign(m) <= 0)
+      BOOST_THROW_EXCEPTION(std::domain_error("The modulus must be positive."));
+   unsigned bits = 0;
+   for (std::size_t i = 0; i < k; ++i)
+   {
+      if (eval_get_sign(exponents[i]) < 0)
+         BOOST_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+      if (!eval_is_zero(exponents[i]))
+         bits = (std::max)(bits, eval_msb(exponents[i]) + 1);
+   }
+   if (k == 1)
+   {
+      //
+      // Nothing to share, but a negative base may give a negative result:
+      //
+      eval_powm(result, bases[0], exponents[0], m);
+      if (eval_get_sign(result) < 0)
+         eval_add(result, m);
+      return;
+   }
+   backends::modular_context<Backend> ctx(m);
+   if (bits == 0)
+   {
+      Backend one;
+      one = ui_type(1u);
+      ctx.to_internal(result, one);
+      ctx.from_internal(one, result);
+      result.swap(one);
+      return;
+   }
+   //
+   // Choose the method and window size by counting multiplications (the bits squarings
+   // are common to both), Straus needs k * (2^w - 2) to build the tables plus k per window,
+   // while Pippenger needs k + 2^(w+1) per window:
+   //
+   unsigned    straus_w = 1, pippenger_w = 1;
+   std::size_t straus_cost = (std::numeric_limits<std::size_t>::max)(), pippenger_cost = straus_cost;
+   for (unsigned w = 1; w < 16; ++w)
+   {
+      std::size_t windows = (bits + w - 1) / w;
+      std::size_t c       = k * ((static_cast<std::size_t>(1u) << w) - 2) + k * windows;
+      if (c < straus_cost)
+      {
+         straus_cost = c;
+         straus_w    = w;
+      }
+      c = windows * (k + (static_cast<std::size_t>(2u) << w));
+      if (c < pippenger_cost)
+      {
+         pippenger_cost = c;
+         pippenger_w    = w;
+      }
+   }
+   std::vector<Backend> g(k);
+   for (std::size_t i = 0; i < k; ++i)
+      ctx.to_internal(g[i], bases[i]);
+
+   Backend x, t;
+   bool    x_one = true;
+   if (straus_cost <= pippenger_cost)
+   {
+      //
+      // Straus: table[i * (2^w - 1) + d - 1] = g_i^d for d in [1, 2^w), then for each
+      // window square w times and multiply in the digit of each exponent:
+      //
+      const unsigned       w    = straus_w;
+      const std::size_t    size = (static_cast<std::size_t>(1u) << w) - 1;
+      std::vector<Backend> table(k * size);
+      for (std::size_t i = 0; i < k; ++i)
+      {
+         table[i * size].swap(g[i]);
+         for (std::size_t d = 1; d < size; ++d)
+            ctx.multiply(table[i * size + d], table[i * size + d - 1], table[i * size]);
+      }
+      for (unsigned pos = ((bits - 1) / w) * w;; pos -= w)
+      {
+         if (!x_one)
+         {
+            for (unsigned j = 0; j < w; ++j)
+            {
+               ctx.square(t, x);
+               x.swap(t);
+            }
+         }
+         for (std::size_t i = 0; i < k; ++i)
+         {
+            unsigned d = detail::multi_powm_digit(exponents[i], pos, w);
+            if (d)
+               detail::multi_powm_accumulate(ctx, x, x_one, table[i * size + d - 1], t);
+         }
+         if (pos == 0)
+            break;
+      }
+   }
+   else
+   {
+      //
+      // Pippenger: for each window, bucket[d - 1] is the product of the g_i whose digit is d,
+      // and prod(bucket[d - 1]^d) is formed with running products, highest d first:
+      //
+      const unsigned       w = pippenger_w;
+      std::vector<Backend> buckets((static_cast<std::size_t>(1u) << w) - 1);
+      std::vector<char>    bucket_one(buckets.size());
+      for (unsigned pos = ((bits - 1) / w) * w;; pos -= w)
+      {
+         if (!x_one)
+         {
+            for (unsigned j = 0; j < w; ++j)
+            {
+               ctx.square(t, x);
+               x.swap(t);
+            }
+         }
+         std::fill(bucket_one.begin(), bucket_one.end(), static_cast<char>(true));
+         unsigned max_digit = 0;
+         for (std::size_t i = 0; i < k; ++i)
+         {
+            unsigned d = detail::multi_powm_digit(exponents[i], pos, w);
+            if (d)
+            {
+               bool b_one = bucket_one[d - 1] != 0;
+               detail::multi_powm_accumulate(ctx, buckets[d - 1], b_one, g[i], t);
+               bucket_one[d - 1] = false;
+               max_digit         = (std::max)(max_digit, d);
+            }
+         }
+         Backend sum;
+         bool    sum_one = true;
+         for (unsigned d = max_digit; d > 0; --d)
+         {
+            if (!bucket_one[d - 1])
+               detail::multi_powm_accumulate(ctx, sum, sum_one, buckets[d - 1], t);
+            if (!sum_one)
+               detail::multi_powm_accumulate(ctx, x, x_one, sum, t);
+         }
+         if (pos == 0)
+            break;
+      }
+   }
+   if (x_one)
+      ctx.one(x);
+   ctx.from_internal(result, x);
+}
+
+} // namespace default_ops
+
+//
+// Returns prod(b^e) mod m over corresponding elements of the ranges of bases
+// [bases_first, bases_last) and exponents starting at exponents_first:
+//
+template <class Iterator1, class Iterator2, class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+multi_powm(Iterator1 bases_first, Iterator1 bases_last, Iterator2 exponents_first, const number<Backend, ExpressionTemplates>& m)
+{
+   using default_ops::eval_multi_powm;
+   std::vector<Backend> bases, exponents;
+   for (; bases_first != bases_last; ++bases_first, ++exponents_first)
+   {
+      bases.push_back(number<Backend, ExpressionTemplates>(*bases_first).backend());
+      exponents.push_back(number<Backend, ExpressionTemplates>(*exponents_first).backend());
+   }
+   number<Backend, ExpressionTemplates> result;
+   eval_multi_powm(result.backend(), bases.empty() ? 0 : &bases[0], exponents.empty() ? 0 : &exponents[0], bases.size(), m.backend());
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<number_category<Backend>::value == number_kind_integer, number<Backend, ExpressionTemplates> >::type
+multi_powm(const std::vector<number<Backend, ExpressionTemplates> >& bases, const std::vector<number<Backend, ExpressionTemplates> >& exponents, const number<Backend, ExpressionTemplates>& m)
+{
+   if (bases.size() != exponents.size())
+      BOOST_THROW_EXCEPTION(std::domain_error("multi_powm requires the same number of bases and exponents."));
+   return multi_powm(bases.begin(), bases.end(), exponents.begin(), m);
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -26,6 +26,7 @@
 #include <boost/multiprecision/detail/generic_interconvert.hpp>
 #include <boost/multiprecision/detail/number_compare.hpp>
 #include <boost/multiprecision/traits/is_restricted_conversion.hpp>
+#include <boost/multiprecision/traits/max_chars.hpp>
 #include <boost/container_hash/hash.hpp>
 #include <istream> // stream operators
 #include <cstdio>  // EOF
@@ -2067,8 +2068,132 @@ inline std::string read_string_while(std::istream& is, std::string const& permit
    return result;
 }
 
+//
+// Returns the end of the longest prefix of [first, last) that looks like a number of the given
+// category, this is the part of the input that from_chars hands on to the backend.  Anything
+// other than an integer or floating point type is passed on whole:
+//
+inline const char* find_number_end(const char* first, const char* last, int category)
+{
+   const char* p = first;
+   if ((p != last) && (*p == '-'))
+      ++p;
+   const char* digits_start = p;
+   if (category == number_kind_integer)
+   {
+      if ((p != last) && (*p == '0'))
+      {
+         ++p;
+         if ((last - p > 1) && ((*p == 'x') || (*p == 'X')) && std::isxdigit(static_cast<unsigned char>(p[1])))
+         {
+            for (p += 2; (p != last) && std::isxdigit(static_cast<unsigned char>(*p)); ++p)
+            {
+            }
+         }
+         else
+         {
+            while ((p != last) && (*p >= '0') && (*p <= '7'))
+               ++p;
+         }
+         return p;
+      }
+      while ((p != last) && (*p >= '0') && (*p <= '9'))
+         ++p;
+      return p == digits_start ? first : p;
+   }
+   else if (category == number_kind_floating_point)
+   {
+      static const char* const names[] = {"infinity", "inf", "nan"};
+      for (unsigned i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+      {
+         const char* q = p;
+         const char* n = names[i];
+         while (*n && (q != last) && (std::tolower(static_cast<unsigned char>(*q)) == *n))
+         {
+            ++q;
+            ++n;
+         }
+         if (!*n)
+            return q;
+      }
+      while ((p != last) && (*p >= '0') && (*p <= '9'))
+         ++p;
+      bool has_digits = p != digits_start;
+      if ((p != last) && (*p == '.'))
+      {
+         const char* q = ++p;
+         while ((p != last) && (*p >= '0') && (*p <= '9'))
+            ++p;
+         has_digits = has_digits || (p != q);
+      }
+      if (!has_digits)
+         return first;
+      if ((p != last) && ((*p == 'e') || (*p == 'E')))
+      {
+         const char* q = p + 1;
+         if ((q != last) && ((*q == '+') || (*q == '-')))
+            ++q;
+         if ((q != last) && (*q >= '0') && (*q <= '9'))
+         {
+            while ((q != last) && (*q >= '0') && (*q <= '9'))
+               ++q;
+            p = q;
+         }
+      }
+      return p;
+   }
+   return last;
+}
+
 } // namespace detail
 
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+//
+// Non-allocating conversion to and from a character buffer, formatting is as for
+// number::str(digits, f), and parsing accepts the same syntax as the string constructors:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline to_chars_result to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& val, std::ios_base::fmtflags f = std::ios_base::fmtflags(0), std::streamsize digits = 0)
+{
+   using default_ops::eval_to_chars;
+   return eval_to_chars(first, last, val.backend(), digits, f);
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline from_chars_result from_chars(const char* first, const char* last, number<Backend, ExpressionTemplates>& val)
+{
+   using default_ops::eval_from_chars;
+   from_chars_result result = {first, std::errc::invalid_argument};
+   const char*       end    = detail::find_number_end(first, last, number_category<Backend>::value);
+   if (end == first)
+      return result;
+#ifndef BOOST_NO_EXCEPTIONS
+   try
+   {
+#endif
+      //
+      // val is left unchanged on failure:
+      //
+      Backend t;
+      eval_from_chars(t, first, end);
+      val.backend().swap(t);
+      result.ptr = end;
+      result.ec  = std::errc();
+#ifndef BOOST_NO_EXCEPTIONS
+   }
+   catch (const std::overflow_error&)
+   {
+      result.ptr = end;
+      result.ec  = std::errc::result_out_of_range;
+   }
+   catch (const std::runtime_error&)
+   {
+   }
+#endif
+   return result;
+}
+#endif
+
 template <class Backend, expression_template_option ExpressionTemplates>
 inline std::istream& operator>>(std::istream& is, number<Backend, ExpressionTemplates>& r)
 {
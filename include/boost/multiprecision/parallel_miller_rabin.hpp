@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Miller-Rabin tests spread over several threads.  The witnesses are all drawn from
+// the caller's engine before any work starts, so the results never depend on how the
+// work happens to be scheduled.
+//
+#ifndef BOOST_MP_PARALLEL_MILLER_RABIN_HPP
+#define BOOST_MP_PARALLEL_MILLER_RABIN_HPP
+
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/multiprecision/detail/parallel_tasks.hpp>
+
+#ifndef BOOST_MP_HAS_PARALLEL_TASKS
+#error "boost/multiprecision/parallel_miller_rabin.hpp requires C++11 thread support."
+#endif
+
+#include <iterator>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+template <class I>
+struct parallel_witness_task
+{
+   const I&              n;
+   const I&              nm1;
+   const I&              q;
+   unsigned              k;
+   const std::vector<I>& witnesses;
+   std::atomic<bool>     composite;
+
+   parallel_witness_task(const I& n_, const I& nm1_, const I& q_, unsigned k_, const std::vector<I>& w)
+       : n(n_), nm1(nm1_), q(q_), k(k_), witnesses(w), composite(false) {}
+
+   void operator()(std::size_t i)
+   {
+      if (composite.load(std::memory_order_relaxed))
+         return; // Another witness has already shown n to be composite.
+      if (!miller_rabin_witness(n, nm1, q, k, witnesses[i]))
+         composite.store(true);
+   }
+};
+
+//
+// Task (trials + 1) * c is the screening of candidate c, and the following trials
+// tasks test one witness each.  A candidate is a probable prime once all of its
+// tasks pass, and we only need the first such:
+//
+template <class I>
+struct parallel_find_task
+{
+   const std::vector<I>&               candidates;
+   const std::vector<I>&               witnesses;
+   unsigned                            trials;
+   std::vector<I>                      nm1, q;
+   std::vector<unsigned>               k;
+   std::vector<char>                   has_witnesses;
+   std::vector<std::atomic<bool> >     composite;
+   std::vector<std::atomic<unsigned> > passed;
+   std::atomic<std::size_t>            best;
+
+   parallel_find_task(const std::vector<I>& c, const std::vector<I>& w, unsigned t)
+       : candidates(c), witnesses(w), trials(t), nm1(c.size()), q(c.size()), k(c.size()), has_witnesses(c.size()), composite(c.size()), passed(c.size()), best(c.size())
+   {
+      for (std::size_t i = 0; i < c.size(); ++i)
+      {
+         composite[i].store(false);
+         passed[i].store(0);
+         if ((c[i] > 227) && bit_test(c[i], 0))
+         {
+            has_witnesses[i] = true;
+            nm1[i]           = c[i] - 1;
+            q[i]   = nm1[i];
+            k[i]   = lsb(q[i]);
+            q[i] >>= k[i];
+         }
+      }
+   }
+   void operator()(std::size_t task)
+   {
+      std::size_t c = task / (trials + 1);
+      unsigned    j = static_cast<unsigned>(task % (trials + 1));
+      if ((c > best.load(std::memory_order_relaxed)) || composite[c].load(std::memory_order_relaxed))
+         return;
+      bool pass;
+      if (j == 0)
+      {
+         int screen = miller_rabin_screen(candidates[c]);
+         if (screen > 0)
+         {
+            found(c);
+            return;
+         }
+         pass = screen == 0;
+      }
+      else if (!has_witnesses[c])
+         return; // Decided by the screening alone.
+      else
+         pass = miller_rabin_witness(candidates[c], nm1[c], q[c], k[c], witnesses[c * trials + j - 1]);
+      if (!pass)
+         composite[c].store(true);
+      else if (passed[c].fetch_add(1) + 1 == trials + 1)
+         found(c);
+   }
+
+ private:
+   parallel_find_task(const parallel_find_task&);
+   parallel_find_task& operator=(const parallel_find_task&);
+
+   void found(std::size_t c)
+   {
+      std::size_t b = best.load();
+      while ((c < b) && !best.compare_exchange_weak(b, c))
+      {
+      }
+   }
+};
+
+} // namespace detail
+
+//
+// Returns the same result as miller_rabin_test(n, trials, gen) with gen in the same state,
+// but tests the witnesses concurrently on up to threads threads (hardware_concurrency()
+// when zero), stopping as soon as any of them shows n to be composite.  Unlike the serial
+// version, all trials witnesses are drawn from gen whenever n passes the initial screening:
+//
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
+parallel_miller_rabin_test(const I& n, unsigned trials, Engine& gen, unsigned threads = 0)
+{
+   typedef I number_type;
+
+   int screen = detail::miller_rabin_screen(n);
+   if (screen)
+      return screen > 0;
+
+   number_type nm1 = n - 1, q = nm1;
+   unsigned    k   = lsb(q);
+   q >>= k;
+
+   boost::random::uniform_int_distribution<number_type> dist(2, n - 2);
+   std::vector<number_type>                             witnesses(trials);
+   for (unsigned i = 0; i < trials; ++i)
+      witnesses[i] = dist(gen);
+
+   detail::parallel_witness_task<number_type> task(n, nm1, q, k, witnesses);
+   detail::parallel_for_tasks(trials, threads, task);
+   return !task.composite.load();
+}
+
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4, class Engine>
+bool parallel_miller_rabin_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n, unsigned trials, Engine& gen, unsigned threads = 0)
+{
+   typedef typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type number_type;
+   return parallel_miller_rabin_test(number_type(n), trials, gen, threads);
+}
+
+//
+// Returns the first element of [first, last) which passes a Miller-Rabin test with
+// trials witnesses, or last if there is none.  The screening and the witnesses of all the
+// candidates are shared out between up to threads threads, and work on a candidate stops
+// as soon as it is shown to be composite, or a probable prime is found before it.  trials
+// witnesses are drawn from gen for each odd candidate greater than 227, in order:
+//
+template <class Iterator, class Engine>
+Iterator parallel_find_probable_prime(Iterator first, Iterator last, unsigned trials, Engine& gen, unsigned threads = 0)
+{
+   typedef typename std::iterator_traits<Iterator>::value_type number_type;
+
+   std::vector<number_type> candidates(first, last), witnesses(candidates.size() * trials);
+   for (std::size_t i = 0; i < candidates.size(); ++i)
+   {
+      if ((candidates[i] > 227) && bit_test(candidates[i], 0))
+      {
+         boost::random::uniform_int_distribution<number_type> dist(2, candidates[i] - 2);
+         for (unsigned j = 0; j < trials; ++j)
+            witnesses[i * trials + j] = dist(gen);
+      }
+   }
+   detail::parallel_find_task<number_type> task(candidates, witnesses, trials);
+   detail::parallel_for_tasks(candidates.size() * (trials + 1), threads, task);
+   std::advance(first, task.best.load());
+   return first;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -0,0 +1,309 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Searching for primes and safe primes: candidates in an arithmetic progression are
+// sieved a window at a time by the small primes, using a table of the residues of the
+// start of the window which is updated incrementally from one window to the next.
+// Only the survivors of the sieve are passed to the Baillie-PSW test, whose Lucas part is
+// carried out in Montgomery form for number types.
+//
+#ifndef BOOST_MP_PRIME_GENERATION_HPP
+#define BOOST_MP_PRIME_GENERATION_HPP
+
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/multiprecision/modular_adaptor.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <vector>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+#ifdef BOOST_MP_PRIME_SIEVE_PRIMES
+static const unsigned prime_sieve_primes = BOOST_MP_PRIME_SIEVE_PRIMES;
+#else
+static const unsigned prime_sieve_primes = 2048;
+#endif
+#ifdef BOOST_MP_PRIME_SIEVE_WINDOW
+static const unsigned prime_sieve_window = BOOST_MP_PRIME_SIEVE_WINDOW;
+#else
+static const unsigned prime_sieve_window = 4096;
+#endif
+
+//
+// The odd primes used by the sieve, boost::math::prime is too slow to call for each one
+// every time we start a search:
+//
+inline const boost::uint32_t* prime_sieve_table()
+{
+   static const struct table
+   {
+      boost::uint32_t data[prime_sieve_primes];
+      table()
+      {
+         for (unsigned i = 0; i < prime_sieve_primes; ++i)
+            data[i] = boost::math::prime(i + 1);
+      }
+   } t;
+   return t.data;
+}
+
+//
+// Sieves the candidates start + k * step for k in [0, prime_sieve_window), rejecting those
+// divisible by one of the odd primes p in the table, and when searching for safe primes
+// also those equal to 1 mod p (for which (candidate - 1) / 2 is divisible by p).  The
+// step must be 2 or 4, and the candidates all larger than 2p + 1 for every p in the table,
+// so that neither a candidate nor its half is itself one of the primes:
+//
+template <class I>
+class prime_sieve
+{
+   const boost::uint32_t*       m_primes;
+   std::vector<boost::uint32_t> m_residues;
+   std::vector<char>            m_composite;
+   I                            m_start;
+   unsigned                     m_step;
+   bool                         m_safe;
+
+ public:
+   prime_sieve(const I& start, unsigned step, bool safe)
+       : m_primes(prime_sieve_table()), m_residues(prime_sieve_primes), m_composite(prime_sieve_window), m_start(start), m_step(step), m_safe(safe)
+   {
+      for (unsigned i = 0; i < prime_sieve_primes; ++i)
+         m_residues[i] = integer_modulus(start, m_primes[i]);
+      sieve();
+   }
+
+   const I& start() const { return m_start; }
+   bool     is_candidate(unsigned k) const { return !m_composite[k]; }
+
+   //
+   // Moves on to the next window, updating the residues without any multiprecision arithmetic:
+   //
+   void advance()
+   {
+      const boost::uint32_t delta = m_step * prime_sieve_window;
+      m_start += delta;
+      for (unsigned i = 0; i < prime_sieve_primes; ++i)
+         m_residues[i] = static_cast<boost::uint32_t>((static_cast<boost::uint64_t>(m_residues[i]) + delta) % m_primes[i]);
+      sieve();
+   }
+
+ private:
+   void mark(boost::uint32_t p, boost::uint32_t k)
+   {
+      for (; k < prime_sieve_window; k += p)
+         m_composite[k] = true;
+   }
+   void sieve()
+   {
+      std::fill(m_composite.begin(), m_composite.end(), static_cast<char>(false));
+      for (unsigned i = 0; i < prime_sieve_primes; ++i)
+      {
+         //
+         // residue + k * step = 0 mod p when k = -residue / step mod p:
+         //
+         boost::uint64_t p   = m_primes[i];
+         boost::uint64_t inv = (p + 1) / 2;
+         if (m_step == 4)
+            inv = inv * inv % p;
+         boost::uint64_t k = (p - m_residues[i]) * inv % p;
+         mark(static_cast<boost::uint32_t>(p), static_cast<boost::uint32_t>(k));
+         if (m_safe)
+            mark(static_cast<boost::uint32_t>(p), static_cast<boost::uint32_t>((k + inv) % p));
+      }
+   }
+};
+
+//
+// Arithmetic modulo n for the Lucas test in Montgomery form, in which x / 2 is still x / 2,
+// saving a division after every product:
+//
+template <class Number>
+class montgomery_lucas_context
+{
+   backends::modular_context<typename Number::backend_type> m_context;
+
+ public:
+   explicit montgomery_lucas_context(const Number& n) : m_context(n.backend()) {}
+
+   void to_internal(Number& r, const Number& a) const { m_context.to_internal(r.backend(), a.backend()); }
+   void multiply(Number& r, const Number& a, const Number& b) const { m_context.multiply(r.backend(), a.backend(), b.backend()); }
+   void add(Number& r, const Number& a) const { m_context.add(r.backend(), a.backend()); }
+   void subtract(Number& r, const Number& a) const { m_context.subtract(r.backend(), a.backend()); }
+};
+
+template <class I>
+bool is_prime_candidate(const I& n, bool safe)
+{
+   typedef typename mpl::if_c<is_integral<I>::value, lucas_modular_context<I>, montgomery_lucas_context<I> >::type context_type;
+   return safe ? baillie_psw_test<context_type>(I(n >> 1)) && baillie_psw_test<context_type>(n) : baillie_psw_test<context_type>(n);
+}
+
+//
+// Finds the smallest prime, or safe prime, p = start + k * step with p <= *max, or with
+// no upper limit when max is null.  Values are never formed above *max, so that it may be
+// the largest value of a fixed precision type.  Returns false if there is no such p:
+//
+template <class I>
+bool prime_search(I& result, I start, const I* max, unsigned step, bool safe)
+{
+   //
+   // Below the sieve's lower limit we just test each candidate:
+   //
+   const boost::uint32_t sieve_limit = 2 * prime_sieve_table()[prime_sieve_primes - 1] + 1;
+   while (start <= sieve_limit)
+   {
+      if (max && (start > *max))
+         return false;
+      if (is_prime_candidate(start, safe))
+      {
+         result = start;
+         return true;
+      }
+      if (max && (*max - start < step))
+         return false;
+      start += step;
+   }
+   if (max && (start > *max))
+      return false;
+   prime_sieve<I> sieve(start, step, safe);
+   while (true)
+   {
+      unsigned count = prime_sieve_window;
+      bool     last  = false;
+      if (max)
+      {
+         //
+         // This is the last window if it reaches *max, in which case we must not advance
+         // past it, as the next start would be above *max:
+         //
+         I remaining = (*max - sieve.start()) / step;
+         if (remaining < prime_sieve_window)
+         {
+            count = static_cast<unsigned>(remaining) + 1;
+            last  = true;
+         }
+      }
+      for (unsigned k = 0; k < count; ++k)
+      {
+         if (sieve.is_candidate(k))
+         {
+            I n = sieve.start();
+            n += k * step;
+            if (is_prime_candidate(n, safe))
+            {
+               result = n;
+               return true;
+            }
+         }
+      }
+      if (last)
+         return false;
+      sieve.advance();
+   }
+}
+
+//
+// Returns a random value with exactly bits bits, built 32 bits at a time:
+//
+template <class I, class Engine>
+I random_bits(unsigned bits, Engine& gen)
+{
+   boost::random::uniform_int_distribution<boost::uint32_t> dist(0, ~static_cast<boost::uint32_t>(0u));
+   I                                                        result(dist(gen));
+   unsigned                                                 chunks = (bits + 31) / 32;
+   for (unsigned i = 1; i < chunks; ++i)
+   {
+      result <<= 32;
+      result |= dist(gen);
+   }
+   result >>= chunks * 32 - bits;
+   I top(1);
+   top <<= bits - 1;
+   return result | top;
+}
+
+//
+// Returns a random prime, or safe prime, with exactly bits bits: we start from a random
+// value with the top bit set and search upwards, starting again if we pass 2^bits:
+//
+template <class I, class Engine>
+I random_prime_search(unsigned bits, Engine& gen, bool safe)
+{
+   if (bits < (safe ? 3u : 2u))
+      BOOST_THROW_EXCEPTION(std::domain_error(safe ? "random_safe_prime requires at least 3 bits." : "random_prime requires at least 2 bits."));
+   I high(1);
+   high <<= bits - 1;
+   --high;
+   high |= I(high + 1);
+
+   I result;
+   while (true)
+   {
+      I start = random_bits<I>(bits, gen);
+      start |= safe ? 3u : 1u;
+      if (prime_search(result, start, &high, safe ? 4u : 2u, safe))
+         return result;
+   }
+}
+
+} // namespace detail
+
+//
+// Returns the smallest prime greater than n, which must be representable in type I:
+//
+template <class I>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+next_prime(const I& n)
+{
+   if (n < 2)
+      return I(2);
+   I start(n);
+   ++start;
+   start |= 1u;
+   I result;
+   if (std::numeric_limits<I>::is_bounded)
+   {
+      I max = (std::numeric_limits<I>::max)();
+      if ((start < n) || !detail::prime_search(result, start, &max, 2, false))
+         BOOST_THROW_EXCEPTION(std::overflow_error("next_prime: the next prime is not representable in the type."));
+   }
+   else
+      detail::prime_search(result, start, static_cast<const I*>(0), 2, false);
+   return result;
+}
+
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4>
+typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type
+next_prime(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n)
+{
+   typedef typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type number_type;
+   return next_prime(number_type(n));
+}
+
+//
+// Returns a random prime p with 2^(bits-1) <= p < 2^bits:
+//
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+random_prime(unsigned bits, Engine& gen)
+{
+   return detail::random_prime_search<I>(bits, gen, false);
+}
+
+//
+// Returns a random prime p with 2^(bits-1) <= p < 2^bits for which (p - 1) / 2 is also prime:
+//
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+random_safe_prime(unsigned bits, Engine& gen)
+{
+   return detail::random_prime_search<I>(bits, gen, true);
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -697,6 +697,27 @@ inline void eval_lcm(tommath_int& result, const tommath_int& a, const tommath_in
 {
    detail::check_tommath_result(mp_lcm(const_cast< ::mp_int*>(&a.data()), const_cast< ::mp_int*>(&b.data()), const_cast< ::mp_int*>(&result.data())));
 }
+inline bool eval_invert_mod(tommath_int& result, const tommath_int& a, const tommath_int& m)
+{
+   //
+   // mp_invmod requires m > 1, and fails with MP_VAL when there is no inverse:
+   //
+   tommath_int am(m);
+   if (eval_get_sign(am) < 0)
+      am.negate();
+   if (mp_cmp_d(&am.data(), 1) != MP_GT)
+   {
+      if (eval_get_sign(am) == 0)
+         return false;
+      mp_zero(&result.data());
+      return true;
+   }
+   int r = mp_invmod(const_cast< ::mp_int*>(&a.data()), &am.data(), &result.data());
+   if (r == MP_VAL)
+      return false;
+   detail::check_tommath_result(r);
+   return true;
+}
 inline void eval_powm(tommath_int& result, const tommath_int& base, const tommath_int& p, const tommath_int& m)
 {
    if (eval_get_sign(p) < 0)
@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_MAX_CHARS_HPP
+#define BOOST_MP_MAX_CHARS_HPP
+
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/multiprecision/detail/number_base.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+template <boost::uintmax_t N>
+struct decimal_digit_count
+{
+   static const std::size_t value = 1 + decimal_digit_count<N / 10>::value;
+};
+template <>
+struct decimal_digit_count<0>
+{
+   static const std::size_t value = 0;
+};
+
+template <class Number, int Category = number_category<Number>::value, bool Bounded = std::numeric_limits<Number>::is_bounded>
+struct max_chars_imp : public boost::integral_constant<std::size_t, 0>
+{};
+//
+// Integers: digits / 3 + 1 covers the decimal and octal digits, and the hex digits
+// plus the "0x" prefix, with 2 more for the sign or base prefix:
+//
+template <class Number>
+struct max_chars_imp<Number, number_kind_integer, true> : public boost::integral_constant<std::size_t, std::numeric_limits<Number>::digits / 3 + 3>
+{};
+//
+// Floating point: up to max_digits10 + 1 digits in scientific format, plus a sign,
+// decimal point, 'e', exponent sign and the exponent itself, with one digit to spare:
+//
+template <class Number>
+struct max_chars_imp<Number, number_kind_floating_point, true>
+    : public boost::integral_constant<std::size_t,
+                                      std::numeric_limits<Number>::max_digits10 + 6 + decimal_digit_count<(static_cast<boost::intmax_t>(std::numeric_limits<Number>::max_exponent10) > -static_cast<boost::intmax_t>(std::numeric_limits<Number>::min_exponent10) ? static_cast<boost::uintmax_t>(std::numeric_limits<Number>::max_exponent10) : static_cast<boost::uintmax_t>(-static_cast<boost::intmax_t>(std::numeric_limits<Number>::min_exponent10)))>::value + 1>
+{};
+
+} // namespace detail
+
+//
+// The largest number of characters to_chars can write for a value of type Number with the
+// default precision and any format other than std::ios_base::fixed, or zero if there is no
+// such limit (as for arbitrary precision types):
+//
+template <class Number>
+struct max_chars : public detail::max_chars_imp<Number>
+{};
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -45,10 +45,28 @@ boost::chrono::duration<double> test_miller_rabin_gmp()
    }
    return c.elapsed();
 }
+
+boost::chrono::duration<double> test_prime_generation_gmp()
+{
+   using namespace boost::random;
+   using namespace boost::multiprecision;
+
+   stopwatch<boost::chrono::high_resolution_clock> c;
+
+   independent_bits_engine<mt11213b, 256, mpz_int> gen;
+
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      mpz_int n = gen();
+      mpz_nextprime(n.backend().data(), n.backend().data());
+   }
+   return c.elapsed();
+}
 #endif
 
 std::map<std::string, double> results;
 double                        min_time = (std::numeric_limits<double>::max)();
+std::map<std::string, double> prime_results;
 
 void generate_quickbook()
 {
@@ -64,6 +82,13 @@ void generate_quickbook()
    }
 
    std::cout << "]\n";
+
+   std::cout << "[table\n[[Integer Type][256-bit Primes Generated per Second]]\n";
+
+   for (i = prime_results.begin(), j = prime_results.end(); i != j; ++i)
+      std::cout << "[[" << i->first << "][" << i->second << "]]\n";
+
+   std::cout << "]\n";
 }
 
 int main()
@@ -80,6 +105,9 @@ int main()
    test10();
    test11();
    test12();
+   test13();
+   test14();
+   test15();
 
    generate_quickbook();
 
@@ -21,6 +21,7 @@
 #include <boost/multiprecision/cpp_int.hpp>
 #endif
 #include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/multiprecision/prime_generation.hpp>
 #include <boost/chrono.hpp>
 #include <map>
 
@@ -49,6 +50,7 @@ extern unsigned allocation_count;
 
 extern std::map<std::string, double> results;
 extern double                        min_time;
+extern std::map<std::string, double> prime_results;
 
 template <class IntType>
 boost::chrono::duration<double> test_miller_rabin(const char* name)
@@ -81,7 +83,43 @@ boost::chrono::duration<double> test_miller_rabin(const char* name)
    return t;
 }
 
+//
+// Measures primes found per second at 256 bits, first by testing random odd
+// candidates one at a time with miller_rabin_test, then with random_prime
+// which sieves the candidates before testing them:
+//
+template <class IntType>
+void test_prime_generation(const char* name)
+{
+   using namespace boost::random;
+
+   static const unsigned prime_count = 100;
+
+   independent_bits_engine<mt11213b, 256, IntType> gen;
+   mt19937                                         gen2;
+
+   stopwatch<boost::chrono::high_resolution_clock> c;
+   for (unsigned found = 0; found < prime_count;)
+   {
+      IntType n = gen();
+      n |= 1u;
+      if (boost::multiprecision::miller_rabin_test(n, 25, gen2))
+         ++found;
+   }
+   double d = boost::chrono::duration<double>(c.elapsed()).count();
+   prime_results[std::string(name) + " (miller_rabin_test)"] = prime_count / d;
+   std::cout << "Primes per second for " << std::setw(30) << std::left << name << " (miller_rabin_test) = " << prime_count / d << std::endl;
+
+   c.reset();
+   for (unsigned found = 0; found < prime_count; ++found)
+      boost::multiprecision::random_prime<IntType>(256, gen2);
+   d = boost::chrono::duration<double>(c.elapsed()).count();
+   prime_results[std::string(name) + " (random_prime)"] = prime_count / d;
+   std::cout << "Primes per second for " << std::setw(30) << std::left << name << " (random_prime)      = " << prime_count / d << std::endl;
+}
+
 boost::chrono::duration<double> test_miller_rabin_gmp();
+boost::chrono::duration<double> test_prime_generation_gmp();
 
 void test01();
 void test02();
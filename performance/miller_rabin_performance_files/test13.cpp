@@ -0,0 +1,15 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include "../miller_rabin_performance.hpp"
+
+void test13()
+{
+   using namespace boost::multiprecision;
+#ifdef TEST_CPP_INT
+   test_prime_generation<cpp_int>("cpp_int");
+   test_prime_generation<uint1024_t>("uint1024_t");
+#endif
+}
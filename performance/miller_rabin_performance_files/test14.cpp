@@ -0,0 +1,15 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include "../miller_rabin_performance.hpp"
+
+void test14()
+{
+   using namespace boost::multiprecision;
+#ifdef TEST_MPZ
+   test_prime_generation<mpz_int>("mpz_int");
+   std::cout << "Primes per second for mpz_int (native mpz_nextprime) = " << 100 / test_prime_generation_gmp().count() << std::endl;
+#endif
+}
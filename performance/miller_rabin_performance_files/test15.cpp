@@ -0,0 +1,14 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include "../miller_rabin_performance.hpp"
+
+void test15()
+{
+   using namespace boost::multiprecision;
+#ifdef TEST_TOMMATH
+   test_prime_generation<boost::multiprecision::tom_int>("tom_int");
+#endif
+}
@@ -0,0 +1,20 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include "test_arithmetic.hpp"
+
+template <>
+struct related_type<boost::multiprecision::cpp_int_pooled>
+{
+   typedef boost::multiprecision::int256_t type;
+};
+
+int main()
+{
+   test<boost::multiprecision::cpp_int_pooled>();
+   return boost::report_errors();
+}
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/batch_gcd.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/random.hpp>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include "test.hpp"
+
+#ifdef TEST_GMP
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+template <class I>
+std::vector<I> naive_batch_gcd(const std::vector<I>& v)
+{
+   std::vector<I> result;
+   for (std::size_t i = 0; i < v.size(); ++i)
+   {
+      I g(0);
+      for (std::size_t j = 0; j < v.size(); ++j)
+         if (i != j)
+            g = gcd(g, v[j]);
+      I p(1);
+      for (std::size_t j = 0; j < v.size(); ++j)
+         if (i != j)
+            p *= v[j];
+      result.push_back(gcd(p, v[i]));
+   }
+   return result;
+}
+
+template <class I, class Engine>
+std::vector<I> make_values(std::size_t count, unsigned bits, Engine& gen)
+{
+   //
+   // Products of pairs of primes, a few of which share a factor:
+   //
+   using namespace boost::multiprecision;
+   std::vector<I> primes;
+   for (std::size_t i = 0; i < count + count / 4 + 1; ++i)
+   {
+      I p = gen();
+      p &= (I(1) << (bits / 2)) - 1;
+      p |= I(1) << (bits / 2 - 1);
+      p |= 1;
+      while (!miller_rabin_test(p, 25))
+         p += 2;
+      primes.push_back(p);
+   }
+   std::vector<I> values;
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      std::size_t a = i, b = count + (i % (count / 4 + 1));
+      if (i % 3)
+         b = (i * 7 + 1) % primes.size();
+      if (a == b)
+         b = count;
+      values.push_back(primes[a] * primes[b]);
+   }
+   return values;
+}
+
+template <class I>
+void test()
+{
+   using namespace boost::multiprecision;
+
+   boost::random::independent_bits_engine<boost::random::mt19937, 512, I> gen;
+
+   static const unsigned threads[] = {1, 2, 3, 0};
+   static const unsigned counts[]  = {1, 2, 3, 5, 16, 37, 100};
+
+   for (unsigned c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c)
+   {
+      std::vector<I> values   = make_values<I>(counts[c], 256, gen);
+      std::vector<I> expected = naive_batch_gcd(values);
+      for (unsigned t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t)
+      {
+         product_tree<I> tree(values.begin(), values.end(), threads[t]);
+         BOOST_CHECK_EQUAL(tree.size(), values.size());
+         I p(1);
+         for (std::size_t i = 0; i < values.size(); ++i)
+            p *= values[i];
+         BOOST_CHECK_EQUAL(tree.root(), p);
+         BOOST_CHECK_EQUAL(tree.level(tree.levels() - 1).size(), 1u);
+
+         I              x    = gen();
+         std::vector<I> rems = remainder_tree(x, tree, threads[t]);
+         BOOST_CHECK_EQUAL(rems.size(), values.size());
+         for (std::size_t i = 0; i < values.size(); ++i)
+            BOOST_CHECK_EQUAL(rems[i], I(x % values[i]));
+         x    = -x;
+         rems = remainder_tree(x, tree, threads[t]);
+         for (std::size_t i = 0; i < values.size(); ++i)
+         {
+            BOOST_CHECK(rems[i] >= 0);
+            BOOST_CHECK_EQUAL(I(rems[i] - x) % values[i], 0);
+         }
+
+         std::vector<I> gcds = batch_gcd(values.begin(), values.end(), threads[t]);
+         BOOST_CHECK(gcds == expected);
+         gcds = batch_gcd(tree, threads[t]);
+         BOOST_CHECK(gcds == expected);
+         //
+         // Streaming to disk, with blocks small enough that each level spans several:
+         //
+         gcds = batch_gcd(values.begin(), values.end(), std::string("test_batch_gcd_tmp"), 3, threads[t]);
+         BOOST_CHECK(gcds == expected);
+         gcds = batch_gcd(values.begin(), values.end(), std::string("test_batch_gcd_tmp"), 4096, threads[t]);
+         BOOST_CHECK(gcds == expected);
+      }
+   }
+   //
+   // Duplicate values share every factor:
+   //
+   std::vector<I> dups(4, I(15));
+   dups.push_back(I(7));
+   std::vector<I> gcds = batch_gcd(dups.begin(), dups.end());
+   BOOST_CHECK_EQUAL(gcds[0], 15);
+   BOOST_CHECK_EQUAL(gcds[4], 1);
+
+   std::vector<I> empty;
+   BOOST_CHECK(batch_gcd(empty.begin(), empty.end()).empty());
+   BOOST_CHECK(batch_gcd(empty.begin(), empty.end(), std::string("test_batch_gcd_tmp")).empty());
+   BOOST_CHECK(remainder_tree(I(3), product_tree<I>(empty.begin(), empty.end())).empty());
+
+   std::vector<I> bad(3, I(5));
+   bad[1] = 0;
+   BOOST_CHECK_THROW(product_tree<I>(bad.begin(), bad.end()), std::domain_error);
+   BOOST_CHECK_THROW(batch_gcd(bad.begin(), bad.end()), std::domain_error);
+   BOOST_CHECK_THROW(batch_gcd(bad.begin(), bad.end(), std::string("test_batch_gcd_tmp")), std::domain_error);
+   BOOST_CHECK(!std::ifstream("test_batch_gcd_tmp.product.0"));
+   //
+   // A bad value after several blocks have been written still leaves no files behind:
+   //
+   std::vector<I> late(dups);
+   late.insert(late.end(), dups.begin(), dups.end());
+   late.push_back(I(-3));
+   BOOST_CHECK_THROW(batch_gcd(late.begin(), late.end(), std::string("test_batch_gcd_tmp"), 2), std::domain_error);
+   BOOST_CHECK(!std::ifstream("test_batch_gcd_tmp.product.0"));
+   BOOST_CHECK_THROW(batch_gcd(dups.begin(), dups.end(), std::string("no/such/directory/test_batch_gcd_tmp")), std::runtime_error);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>();
+   test<number<cpp_int_backend<>, et_off> >();
+#ifdef TEST_GMP
+   test<mpz_int>();
+#endif
+
+   return boost::report_errors();
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+template <class I>
+void test()
+{
+   using namespace boost::random;
+   using namespace boost::multiprecision;
+
+   typedef I test_type;
+
+   static const unsigned test_bits =
+       std::numeric_limits<test_type>::digits && (std::numeric_limits<test_type>::digits <= 256)
+           ? std::numeric_limits<test_type>::digits
+           : 128;
+
+   independent_bits_engine<mt11213b, test_bits, test_type> gen;
+   //
+   // All the primes in our table, and none of their neighbours:
+   //
+   for (unsigned i = 1; i < boost::math::max_prime; ++i)
+   {
+      BOOST_TEST(bpsw_test(test_type(boost::math::prime(i))));
+      BOOST_TEST(!bpsw_test(test_type(boost::math::prime(i) + 1)));
+      if (boost::math::prime(i + 1) - boost::math::prime(i) > 2)
+         BOOST_TEST(!bpsw_test(test_type(boost::math::prime(i) + 2)));
+   }
+   BOOST_TEST(!bpsw_test(test_type(0)));
+   BOOST_TEST(!bpsw_test(test_type(1)));
+   BOOST_TEST(bpsw_test(test_type(2)));
+   //
+   // Strong pseudoprimes to base 2, Carmichael numbers, and strong Lucas pseudoprimes
+   // for Selfridge's parameters (OEIS A001262, A002997, A217255), all composite:
+   //
+   static const boost::uint32_t composites[] = {
+       2047u, 3277u, 4033u, 4681u, 8321u, 15841u, 29341u, 42799u, 49141u, 52633u, 65281u, 74665u, 80581u, 85489u, 88357u, 90751u,
+       561u, 1105u, 1729u, 2465u, 2821u, 6601u, 8911u, 10585u, 15841u, 29341u, 41041u, 46657u, 52633u, 62745u, 63973u, 75361u,
+       5459u, 5777u, 10877u, 16109u, 18971u, 22499u, 24569u, 25199u, 40309u, 58519u, 75077u, 97439u, 100127u, 113573u, 115639u, 130139u,
+       3215031751u};
+   for (unsigned i = 0; i < sizeof(composites) / sizeof(composites[0]); ++i)
+   {
+      BOOST_TEST(!bpsw_test(test_type(composites[i])));
+   }
+   //
+   // The strong Lucas pseudoprimes do pass the Lucas part of the test on its own:
+   //
+   for (unsigned i = 32; i < 48; ++i)
+   {
+      BOOST_TEST(boost::multiprecision::detail::strong_lucas_test<boost::multiprecision::detail::lucas_modular_context<test_type> >(test_type(composites[i])));
+   }
+   //
+   // Squares of primes, for which the Lucas parameter search fails:
+   //
+   BOOST_TEST(!bpsw_test(test_type(229u * 229u)));
+   BOOST_TEST(!bpsw_test(test_type(251u * 251u)));
+   BOOST_TEST(!bpsw_test(test_type(65521u * 65521u)));
+   //
+   // Random values, compared with GMP's probabilistic test:
+   //
+   for (unsigned i = 0; i < 10000; ++i)
+   {
+      test_type n           = gen();
+      bool      is_prime     = bpsw_test(n);
+      bool      is_gmp_prime = mpz_probab_prime_p(mpz_int(n).backend().data(), 25) ? true : false;
+      if (is_prime != is_gmp_prime)
+         std::cout << std::hex << std::showbase << "n = " << n << std::endl;
+      BOOST_CHECK_EQUAL(is_prime, is_gmp_prime);
+      //
+      // And random odd values with no small factors, which exercise the full test:
+      //
+      n |= 1;
+      if (boost::multiprecision::detail::check_small_factors(n))
+      {
+         is_prime     = bpsw_test(n);
+         is_gmp_prime = mpz_probab_prime_p(mpz_int(n).backend().data(), 25) ? true : false;
+         if (is_prime != is_gmp_prime)
+            std::cout << std::hex << std::showbase << "n = " << n << std::endl;
+         BOOST_CHECK_EQUAL(is_prime, is_gmp_prime);
+      }
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<mpz_int>();
+   test<number<gmp_int, et_off> >();
+   test<boost::uint64_t>();
+   test<boost::uint32_t>();
+   test<cpp_int>();
+   test<number<cpp_int_backend<64, 64, unsigned_magnitude, checked, void>, et_off> >();
+   test<checked_uint128_t>();
+   test<checked_uint1024_t>();
+   //
+   // Expression templates:
+   //
+   cpp_int a(1), b(3);
+   a <<= 127;
+   BOOST_TEST(bpsw_test(a - 1));
+   BOOST_TEST(!bpsw_test(a * b + 1));
+
+   return boost::report_errors();
+}
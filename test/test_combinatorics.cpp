@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/combinatorics.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+#ifdef TEST_GMP
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+template <class I>
+I naive_factorial(unsigned n, unsigned step = 1)
+{
+   I result(1);
+   for (unsigned i = n; (i > 1) && (i <= n); i -= step)
+      result *= i;
+   return result;
+}
+
+template <class I>
+I naive_primorial(unsigned n)
+{
+   I result(1);
+   for (unsigned i = 2; i <= n; ++i)
+   {
+      bool prime = true;
+      for (unsigned j = 2; j * j <= i; ++j)
+         if (i % j == 0)
+            prime = false;
+      if (prime)
+         result *= i;
+   }
+   return result;
+}
+
+template <class I>
+void test()
+{
+   using namespace boost::multiprecision;
+
+   static const unsigned threads[] = {1, 2, 3, 0};
+   static const unsigned values[]  = {0, 1, 2, 3, 4, 5, 10, 20, 21, 50, 97, 100, 255, 256, 1000, 2049, 5000};
+
+   for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+   {
+      unsigned n = values[i];
+      I        f = naive_factorial<I>(n);
+      I        d = naive_factorial<I>(n, 2);
+      I        p = naive_primorial<I>(n);
+      for (unsigned t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t)
+      {
+         BOOST_CHECK_EQUAL(factorial<I>(n, threads[t]), f);
+         BOOST_CHECK_EQUAL(double_factorial<I>(n, threads[t]), d);
+         BOOST_CHECK_EQUAL(primorial<I>(n, threads[t]), p);
+         unsigned ks[] = {0, 1, n / 3, n / 2, n - 1, n};
+         for (unsigned k = 0; k < sizeof(ks) / sizeof(ks[0]); ++k)
+         {
+            if (ks[k] > n)
+               continue;
+            BOOST_CHECK_EQUAL(binomial<I>(n, ks[k], threads[t]), I(f / (naive_factorial<I>(ks[k]) * naive_factorial<I>(n - ks[k]))));
+         }
+      }
+   }
+   BOOST_CHECK_EQUAL(binomial<I>(5, 6), 0);
+   BOOST_CHECK_EQUAL(binomial<I>(0, 0), 1);
+   BOOST_CHECK_EQUAL(binomial<I>(52, 5), 2598960);
+   BOOST_CHECK_EQUAL(factorial<I>(20), I(2432902008176640000uLL));
+   BOOST_CHECK_EQUAL(double_factorial<I>(9), 945);
+   BOOST_CHECK_EQUAL(primorial<I>(30), 6469693230uLL);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>();
+   test<number<cpp_int_backend<>, et_off> >();
+   //
+   // Fixed precision types are fine so long as the result fits, 5000! is a little under 54000 bits:
+   //
+   test<number<cpp_int_backend<60000, 60000, unsigned_magnitude, unchecked, void> > >();
+#ifdef TEST_GMP
+   test<mpz_int>();
+#endif
+
+   return boost::report_errors();
+}
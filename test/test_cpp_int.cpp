@@ -28,13 +28,14 @@
 #pragma warning(disable : 4127) //  Conditional expression is constant
 #endif
 
-#if !defined(TEST1) && !defined(TEST2) && !defined(TEST3) && !defined(TEST4) && !defined(TEST5) && !defined(TEST6)
+#if !defined(TEST1) && !defined(TEST2) && !defined(TEST3) && !defined(TEST4) && !defined(TEST5) && !defined(TEST6) && !defined(TEST7)
 #define TEST1
 #define TEST2
 #define TEST3
 #define TEST4
 #define TEST5
 #define TEST6
+#define TEST7
 #endif
 
 template <class T>
@@ -226,11 +227,66 @@ struct tester
       BOOST_CHECK_EQUAL(mpz_int(gcd(mpz_int(0), -b)).str(), test_type(gcd(test_type(0), -b1)).str());
       BOOST_CHECK_EQUAL(mpz_int(gcd(a, mpz_int(0))).str(), test_type(gcd(a1, test_type(0))).str());
       BOOST_CHECK_EQUAL(mpz_int(gcd(-a, mpz_int(0))).str(), test_type(gcd(a1, test_type(0))).str());
+      // Extended gcd, the cofactors should be the same as GMP's:
+      mpz_int   s, t;
+      test_type s1, t1;
+      BOOST_CHECK_EQUAL(gcdext(a, b, s, t).str(), gcdext(a1, b1, s1, t1).str());
+      BOOST_CHECK_EQUAL(s.str(), s1.str());
+      BOOST_CHECK_EQUAL(t.str(), t1.str());
+      BOOST_CHECK_EQUAL(gcdext(mpz_int(-a), c, s, t).str(), gcdext(test_type(-a1), c1, s1, t1).str());
+      BOOST_CHECK_EQUAL(s.str(), s1.str());
+      BOOST_CHECK_EQUAL(t.str(), t1.str());
+      BOOST_CHECK_EQUAL(gcdext(mpz_int(c * d), mpz_int(-b * d), s, t).str(), gcdext(test_type(c1 * d1), test_type(-b1 * d1), s1, t1).str());
+      BOOST_CHECK_EQUAL(s.str(), s1.str());
+      BOOST_CHECK_EQUAL(t.str(), t1.str());
+      // Modular inverse:
+      if ((c > 1) && (gcd(a, c) == 1))
+      {
+         BOOST_CHECK_EQUAL(invert_mod(a, c).str(), invert_mod(a1, c1).str());
+         BOOST_CHECK_EQUAL(invert_mod(mpz_int(-a), c).str(), invert_mod(test_type(-a1), c1).str());
+      }
+      else if (c > 1)
+      {
+         BOOST_CHECK_THROW(invert_mod(a1, c1), std::domain_error);
+      }
       // Integer sqrt:
       mpz_int   r;
       test_type r1;
       BOOST_CHECK_EQUAL(sqrt(a, r).str(), sqrt(a1, r1).str());
       BOOST_CHECK_EQUAL(r.str(), r1.str());
+      BOOST_CHECK_EQUAL(sqrt(mpz_int(a * b), r).str(), sqrt(test_type(a1 * b1), r1).str());
+      BOOST_CHECK_EQUAL(r.str(), r1.str());
+      BOOST_CHECK_EQUAL(sqrt(mpz_int(c * c), r).str(), sqrt(test_type(c1 * c1), r1).str());
+      BOOST_CHECK_EQUAL(r.str(), r1.str());
+      // Integer k'th roots, rounded towards zero:
+      static const unsigned roots[] = {1, 2, 3, 4, 5, 7, 16, 33, 200, 999, 1001};
+      for (unsigned i = 0; i < sizeof(roots) / sizeof(roots[0]); ++i)
+      {
+         BOOST_CHECK_EQUAL(integer_root(a, roots[i]).str(), integer_root(a1, roots[i]).str());
+         BOOST_CHECK_EQUAL(integer_root(mpz_int(b * c), roots[i]).str(), integer_root(test_type(b1 * c1), roots[i]).str());
+      }
+      BOOST_CHECK_EQUAL(integer_root(mpz_int(-a), 3).str(), integer_root(test_type(-a1), 3).str());
+      BOOST_CHECK_EQUAL(integer_root(mpz_int(c * c * c), 3).str(), integer_root(test_type(c1 * c1 * c1), 3).str());
+      BOOST_CHECK_EQUAL(integer_root(mpz_int(c * c * c - 1), 3).str(), integer_root(test_type(c1 * c1 * c1 - 1), 3).str());
+      BOOST_CHECK_THROW(integer_root(a1, 0), std::domain_error);
+      if (a1 > 0)
+      {
+         BOOST_CHECK_THROW(integer_root(test_type(-a1), 2), std::domain_error);
+      }
+      // Perfect squares and powers:
+      BOOST_CHECK_EQUAL(is_perfect_square(a), is_perfect_square(a1));
+      BOOST_CHECK_EQUAL(is_perfect_square(mpz_int(-c * c)), is_perfect_square(test_type(-c1 * c1)));
+      BOOST_CHECK(is_perfect_square(test_type(c1 * c1)));
+      BOOST_CHECK(is_perfect_square(test_type(d1 * d1)));
+      BOOST_CHECK_EQUAL(is_perfect_square(mpz_int(c * c + 1)), is_perfect_square(test_type(c1 * c1 + 1)));
+      BOOST_CHECK_EQUAL(is_perfect_power(a), is_perfect_power(a1));
+      BOOST_CHECK_EQUAL(is_perfect_power(mpz_int(-a)), is_perfect_power(test_type(-a1)));
+      BOOST_CHECK(is_perfect_power(test_type(c1 * c1 * c1)));
+      BOOST_CHECK(is_perfect_power(test_type(-c1 * c1 * c1)));
+      BOOST_CHECK(is_perfect_power(test_type(d1 * d1 * d1 * d1 * d1)));
+      BOOST_CHECK_EQUAL(is_perfect_power(mpz_int(c * c * c + 1)), is_perfect_power(test_type(c1 * c1 * c1 + 1)));
+      BOOST_CHECK_EQUAL(is_perfect_power(mpz_int(-c * c)), is_perfect_power(test_type(-c1 * c1)));
+      BOOST_CHECK_EQUAL(is_perfect_power(mpz_int(-(c * c * c) * 64)), is_perfect_power(test_type(-(c1 * c1 * c1) * 64)));
    }
 
    void t3()
@@ -857,6 +913,10 @@ int main()
 #ifdef TEST6
    tester<number<cpp_int_backend<2048, 2048, signed_magnitude, checked, void> > > t6;
    t6.test();
+#endif
+#ifdef TEST7
+   tester<cpp_int_pooled> t7;
+   t7.test();
 #endif
    return boost::report_errors();
 }
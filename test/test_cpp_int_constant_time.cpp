@@ -0,0 +1,103 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+template <class T>
+T generate_random(unsigned max_limbs)
+{
+   static boost::random::mt19937                     gen;
+   boost::random::uniform_int_distribution<unsigned> ui(0, max_limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+template <class T>
+void test_values(const T& a, const T& b, const T& c)
+{
+   using boost::multiprecision::constant_time;
+
+   BOOST_CHECK_EQUAL(powm(a, b, c, constant_time), T(powm(a, b, c)));
+   BOOST_CHECK_EQUAL(compare(a, b, constant_time), a < b ? -1 : a > b ? 1 : 0);
+   BOOST_CHECK_EQUAL(compare(b, a, constant_time), b < a ? -1 : b > a ? 1 : 0);
+   BOOST_CHECK_EQUAL(compare(a, a, constant_time), 0);
+
+   T x(a), y(b);
+   conditional_swap(x, y, false, constant_time);
+   BOOST_CHECK_EQUAL(x, a);
+   BOOST_CHECK_EQUAL(y, b);
+   conditional_swap(x, y, true, constant_time);
+   BOOST_CHECK_EQUAL(x, b);
+   BOOST_CHECK_EQUAL(y, a);
+   //
+   // Results must be normalised, so that the usual operations still work:
+   //
+   BOOST_CHECK_EQUAL(T(x + 0), b);
+   BOOST_CHECK_EQUAL(x.str(), b.str());
+}
+
+template <class T>
+void test(unsigned max_limbs, unsigned count)
+{
+   for (unsigned i = 0; i < count; ++i)
+   {
+      T c = generate_random<T>(max_limbs) | 1u;
+      test_values(generate_random<T>(max_limbs), generate_random<T>(max_limbs), c);
+      test_values(generate_random<T>(2 * max_limbs), generate_random<T>(max_limbs), c);
+      test_values(generate_random<T>(max_limbs), generate_random<T>(2 * max_limbs), T(generate_random<T>(2 * max_limbs) | 1u));
+      //
+      // Values differing only in low limbs, or only high limbs:
+      //
+      T a = generate_random<T>(2 * max_limbs);
+      test_values(a, T(a ^ 1u), c);
+      test_values(a, T(a ^ (T(1) << (std::numeric_limits<T>::digits - 1))), c);
+      //
+      // Special cases:
+      //
+      test_values(T(0), generate_random<T>(max_limbs), c);
+      test_values(generate_random<T>(max_limbs), T(0), c);
+      test_values(T(c - 1), T(c - 2), c);
+      test_values(c, generate_random<T>(max_limbs), c);
+      test_values(generate_random<T>(max_limbs), generate_random<T>(max_limbs), T(1));
+   }
+   T m = (std::numeric_limits<T>::max)();
+   test_values(T(m - 1), m, m);
+   test_values(m, m, T(m - 2));
+   BOOST_CHECK_THROW(powm(T(2), T(3), T(4), boost::multiprecision::constant_time), std::domain_error);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<uint256_t>(3, 50);
+   test<uint512_t>(7, 50);
+   test<number<cpp_int_backend<520, 520, unsigned_magnitude, unchecked, void> > >(7, 50);
+   test<number<cpp_int_backend<2048, 2048, unsigned_magnitude, checked, void> > >(30, 10);
+   test<number<cpp_int_backend<4096, 4096, unsigned_magnitude, unchecked, void>, et_off> >(60, 3);
+   return boost::report_errors();
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+template <class T>
+T generate_random(unsigned max_limbs)
+{
+   static boost::random::mt19937                     gen;
+   boost::random::uniform_int_distribution<unsigned> ui(0, max_limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+template <class T>
+void test_values(const boost::multiprecision::divisor<T>& d, const T& x)
+{
+   T q, r;
+   d.qr(x, q, r);
+   BOOST_CHECK_EQUAL(q, x / d.value());
+   BOOST_CHECK_EQUAL(r, x % d.value());
+   BOOST_CHECK_EQUAL(d.divide(x), x / d.value());
+   BOOST_CHECK_EQUAL(d.mod(x), x % d.value());
+}
+
+template <class T>
+void test_divisor(unsigned max_limbs, const boost::mpl::true_&)
+{
+   // Negative values:
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      T                                   y = generate_random<T>(max_limbs) + 1;
+      boost::multiprecision::divisor<T> d(T(-y));
+      T                                   x = generate_random<T>(2 * max_limbs);
+      test_values(d, x);
+      test_values(d, T(-x));
+      boost::multiprecision::divisor<T> d2(y);
+      test_values(d2, T(-x));
+   }
+}
+
+template <class T>
+void test_divisor(unsigned, const boost::mpl::false_&)
+{
+}
+
+template <class T>
+void test_divisor(unsigned max_limbs)
+{
+   for (unsigned i = 0; i < 500; ++i)
+   {
+      T                                   y = generate_random<T>(max_limbs) + 1;
+      boost::multiprecision::divisor<T> d(y);
+      for (unsigned j = 0; j < 10; ++j)
+         test_values(d, generate_random<T>(2 * max_limbs));
+      //
+      // Special cases, including those where a quotient limb is all ones:
+      //
+      test_values(d, T(0));
+      test_values(d, T(y - 1));
+      test_values(d, y);
+      test_values(d, T(y * 2));
+      T x = y;
+      x <<= 32 * max_limbs;
+      test_values(d, T(x - 1));
+      test_values(d, x);
+   }
+   T y(1);
+   y <<= 32 * max_limbs + 31;
+   boost::multiprecision::divisor<T> d(y);
+   test_values(d, T(y - 1));
+   test_values(d, T(y * y - 1));
+   test_values(d, T(y * y + 1));
+
+   test_divisor<T>(max_limbs, boost::mpl::bool_<std::numeric_limits<T>::is_signed>());
+
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(boost::multiprecision::divisor<T>(T(0)), std::overflow_error);
+#endif
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test_divisor<cpp_int>(3);
+   test_divisor<cpp_int>(20);
+   test_divisor<cpp_int>(300);
+   test_divisor<checked_int1024_t>(14);
+   test_divisor<uint1024_t>(14);
+   test_divisor<number<cpp_int_backend<8192, 8192, signed_magnitude, checked, void> > >(120);
+   return boost::report_errors();
+}
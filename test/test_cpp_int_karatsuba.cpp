@@ -182,6 +182,24 @@ typename boost::enable_if_c<boost::multiprecision::backends::is_fixed_precision<
          std::cout << y << std::endl;
       }
    }
+   //
+   // Products above the Karatsuba cutoff whose high limbs are zero must come back
+   // normalised, or a following division trips over the leading zero limbs:
+   //
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   for (unsigned limbs = backends::karatsuba_cutoff; 2 * limbs * limb_bits < (unsigned)std::numeric_limits<N>::digits; limbs += 7)
+   {
+      x = 1;
+      x <<= limb_bits * (limbs - 1);
+      ++x;
+      y = x + 2;
+      N z = x * y;
+      BOOST_CHECK_EQUAL(N(N(z * 3 + 1) / z), 3);
+      BOOST_CHECK_EQUAL(N(N(z * 3 + 1) % z), 1);
+      z = x * x;
+      BOOST_CHECK_EQUAL(N(N(z * 3 + 1) / z), 3);
+      BOOST_CHECK_EQUAL(N(N(z * 3 + 1) % z), 1);
+   }
 }
 template <class N>
 typename boost::disable_if_c<boost::multiprecision::backends::is_fixed_precision<typename N::backend_type>::value && !is_checked_cpp_int<N>::value>::type test(const N&)
@@ -210,6 +228,14 @@ typename boost::disable_if_c<boost::multiprecision::backends::is_fixed_precision
       N g1(g);
       N r1 = f1 * g1;
       BOOST_CHECK_EQUAL(r1.str(), r.str());
+      //
+      // Squaring takes a separate code path:
+      //
+      r = f * f;
+      if (std::numeric_limits<N>::is_bounded)
+         r &= mask;
+      r1 = f1 * f1;
+      BOOST_CHECK_EQUAL(r1.str(), r.str());
 
       if (last_error_count != (unsigned)boost::detail::test_errors())
       {
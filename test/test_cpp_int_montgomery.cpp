@@ -0,0 +1,122 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+template <class T>
+T generate_random(unsigned max_limbs)
+{
+   static boost::random::mt19937                     gen;
+   boost::random::uniform_int_distribution<unsigned> ui(0, max_limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+//
+// The square and multiply algorithm which eval_powm used before Montgomery
+// multiplication, as a reference:
+//
+template <class T, class U>
+T reference_powm(const T& a, const U& p, const T& c)
+{
+   T result;
+   boost::multiprecision::default_ops::eval_powm(result.backend(), a.backend(), p, c.backend());
+   return result;
+}
+
+template <class T>
+void test_values(const T& a, const T& p, const T& c)
+{
+   BOOST_CHECK_EQUAL(T(powm(a, p, c)), reference_powm(a, p.backend(), c));
+   unsigned long long ui = static_cast<unsigned long long>(p & 0xFFFFFFFFFFFFull);
+   BOOST_CHECK_EQUAL(T(powm(a, ui, c)), reference_powm(a, ui, c));
+}
+
+template <class T>
+void test_montgomery(unsigned max_limbs, const boost::mpl::true_&)
+{
+   // Negative bases and moduli:
+   for (unsigned i = 0; i < 50; ++i)
+   {
+      T c = generate_random<T>(max_limbs) | 1;
+      T a = generate_random<T>(2 * max_limbs);
+      T p = generate_random<T>(max_limbs);
+      test_values(T(-a), p, c);
+      test_values(T(-a), T(p | 1), c);
+      test_values(a, p, T(-c));
+      test_values(T(-a), p, T(-c));
+   }
+}
+
+template <class T>
+void test_montgomery(unsigned, const boost::mpl::false_&)
+{
+}
+
+template <class T>
+void test_montgomery(unsigned max_limbs)
+{
+   for (unsigned i = 0; i < 50; ++i)
+   {
+      T c = generate_random<T>(max_limbs) | 1;
+      test_values(generate_random<T>(max_limbs), generate_random<T>(max_limbs), c);
+      test_values(generate_random<T>(2 * max_limbs), generate_random<T>(max_limbs), c);
+      //
+      // Special cases:
+      //
+      test_values(T(0), generate_random<T>(max_limbs), c);
+      test_values(T(c - 1), generate_random<T>(max_limbs), c);
+      test_values(c, generate_random<T>(max_limbs), c);
+      test_values(generate_random<T>(max_limbs), T(0), c);
+      test_values(generate_random<T>(max_limbs), T(1), c);
+      test_values(generate_random<T>(max_limbs), generate_random<T>(max_limbs), T(1));
+   }
+   //
+   // Moduli with all bits set, so intermediate results are close to the modulus:
+   //
+   T c(1);
+   c <<= 32 * max_limbs + 32;
+   --c;
+   test_values(T(c - 1), T(c - 2), c);
+   test_values(T(c - 2), c, c);
+
+   test_montgomery<T>(max_limbs, boost::mpl::bool_<std::numeric_limits<T>::is_signed>());
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test_montgomery<cpp_int>(1);
+   test_montgomery<cpp_int>(6);
+   test_montgomery<cpp_int>(32);
+   test_montgomery<cpp_int>(90);
+   test_montgomery<checked_int1024_t>(14);
+   test_montgomery<uint1024_t>(14);
+   test_montgomery<number<cpp_int_backend<8192, 8192, signed_magnitude, checked, void> > >(100);
+   return boost::report_errors();
+}
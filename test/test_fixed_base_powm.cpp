@@ -0,0 +1,114 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/fixed_base_powm.hpp>
+#ifdef TEST_GMP
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+template <class T>
+T generate_random(unsigned max_limbs)
+{
+   static boost::random::mt19937                     gen;
+   boost::random::uniform_int_distribution<unsigned> ui(0, max_limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+template <class T>
+T reduce(const T& a, const T& n)
+{
+   T r = a % n;
+   return r < 0 ? T(r + n) : r;
+}
+
+template <class T>
+void test_values(const T& g, const T& m, unsigned max_bits)
+{
+   boost::multiprecision::fixed_base_powm<T> f(g, m, max_bits);
+   BOOST_CHECK_EQUAL(f.base(), reduce(g, m));
+   BOOST_CHECK_EQUAL(f.modulus(), m);
+   BOOST_CHECK(f.max_bits() >= max_bits);
+   for (unsigned i = 0; i < 10; ++i)
+   {
+      T e = generate_random<T>(max_bits / 32);
+      if (msb(e) >= max_bits)
+         e >>= msb(e) + 1 - max_bits;
+      BOOST_CHECK_EQUAL(f(e), T(powm(reduce(g, m), e, m)));
+   }
+   //
+   // Special cases, including exponents too large for the table:
+   //
+   BOOST_CHECK_EQUAL(f(T(0)), T(powm(reduce(g, m), 0, m)));
+   BOOST_CHECK_EQUAL(f(T(1)), reduce(g, m));
+   T e(1);
+   e <<= f.max_bits() - 1;
+   BOOST_CHECK_EQUAL(f(e), T(powm(reduce(g, m), e, m)));
+   BOOST_CHECK_EQUAL(f(T(e - 1)), T(powm(reduce(g, m), T(e - 1), m)));
+   e <<= 1;
+   BOOST_CHECK_EQUAL(f(e), T(powm(reduce(g, m), e, m)));
+   BOOST_CHECK_EQUAL(f(T(e + 3)), T(powm(reduce(g, m), T(e + 3), m)));
+}
+
+template <class T>
+void test(unsigned max_limbs)
+{
+   for (unsigned i = 0; i < 20; ++i)
+   {
+      T m = generate_random<T>(max_limbs);
+      if (m < 2)
+         m = 2;
+      test_values(generate_random<T>(max_limbs), T(m | 1), 32 * max_limbs + 32);
+      test_values(generate_random<T>(max_limbs), m, 32 * max_limbs + 32);
+      test_values(generate_random<T>(2 * max_limbs), T(m | 1), 64);
+      test_values(generate_random<T>(max_limbs), T(m | 1), 7);
+   }
+   test_values(T(0), T(101), 100);
+   test_values(T(5), T(1), 100);
+   test_values(T(-5), T(101), 100);
+
+   boost::multiprecision::fixed_base_powm<T> f(T(3), T(101), 32);
+   BOOST_CHECK_THROW(f(T(-1)), std::runtime_error);
+   BOOST_CHECK_THROW(boost::multiprecision::fixed_base_powm<T>(T(3), T(0), 32), std::domain_error);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(1);
+   test<cpp_int>(8);
+   test<cpp_int>(64);
+   test<number<cpp_int_backend<>, et_off> >(4);
+   test<int1024_t>(14);
+#ifdef TEST_GMP
+   test<mpz_int>(8);
+   test<mpz_int>(64);
+#endif
+   return boost::report_errors();
+}
@@ -94,6 +94,14 @@ void do_round_trip(const T& val, std::ios_base::fmtflags f)
    BOOST_CHECK_EQUAL(new_val, val);
    ss >> new_val;
    BOOST_CHECK_EQUAL(new_val, val);
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+   //
+   // Parsing from a range that is not null-terminated:
+   //
+   std::string s = "  " + val.str(0, f) + "12";
+   new_val       = static_cast<T>(std::string_view(s.data() + 2, s.size() - 4));
+   BOOST_CHECK_EQUAL(new_val, val);
+#endif
 }
 
 template <class T>
@@ -134,6 +142,22 @@ void negative_spots(const boost::mpl::false_&)
 {
 }
 
+template <class T>
+void test_octal_spill()
+{
+   //
+   // Octal strings whose leading digit spills over into an extra limb.  Each is parsed
+   // straight after a hex string of all ones, so that an uncleared limb shows up:
+   //
+   unsigned max_digits = std::numeric_limits<T>::is_bounded ? (std::numeric_limits<T>::digits - 4) / 3 : 200;
+   for (unsigned digits = 1; digits <= max_digits; ++digits)
+   {
+      T val = static_cast<T>(std::string("0x") + std::string(3 * digits / 4 + 1, 'f'));
+      val   = static_cast<T>(std::string("0") + std::string(digits, '7'));
+      BOOST_CHECK_EQUAL(val, T((T(1) << (3 * digits)) - 1));
+   }
+}
+
 template <class T>
 void test_round_trip()
 {
@@ -156,6 +180,7 @@ void test_round_trip()
    BOOST_CHECK_EQUAL(T(1002).str(0, std::ios_base::dec | std::ios_base::showbase), "1002");
 
    negative_spots<T>(boost::mpl::bool_<std::numeric_limits<T>::is_signed>());
+   test_octal_spill<T>();
 }
 
 int main()
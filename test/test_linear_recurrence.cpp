@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/linear_recurrence.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+#ifdef TEST_GMP
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+template <class I>
+std::vector<I> naive_terms(const std::vector<I>& c, const std::vector<I>& init, unsigned count)
+{
+   std::vector<I> a(init);
+   while (a.size() < count)
+   {
+      I t(0);
+      for (std::size_t j = 0; j < c.size(); ++j)
+         t += c[j] * a[a.size() - 1 - j];
+      a.push_back(t);
+   }
+   return a;
+}
+
+template <class I>
+void test()
+{
+   using namespace boost::multiprecision;
+
+   std::vector<I> c(2, I(1)), init(2);
+   init[1]                = 1;
+   std::vector<I> fib     = naive_terms(c, init, 500);
+   init[0]                = 2;
+   std::vector<I> luc     = naive_terms(c, init, 500);
+   I              moduli[] = {I(1), I(2), I(1000), I(1000000007), (I(1) << 130) + 3, (I(1) << 130)};
+
+   for (unsigned n = 0; n < fib.size(); ++n)
+   {
+      BOOST_CHECK_EQUAL(fibonacci<I>(n), fib[n]);
+      BOOST_CHECK_EQUAL(lucas<I>(n), luc[n]);
+      BOOST_CHECK_EQUAL(fibonacci<I>(I(n)), fib[n]);
+      BOOST_CHECK_EQUAL(linear_recurrence_nth(c, init, n), luc[n]);
+      for (unsigned m = 0; m < sizeof(moduli) / sizeof(moduli[0]); ++m)
+      {
+         BOOST_CHECK_EQUAL(fibonacci(n, moduli[m]), I(fib[n] % moduli[m]));
+         BOOST_CHECK_EQUAL(lucas(n, moduli[m]), I(luc[n] % moduli[m]));
+         BOOST_CHECK_EQUAL(linear_recurrence_nth(c, init, n, moduli[m]), I(luc[n] % moduli[m]));
+      }
+   }
+   //
+   // F(2n) = F(n)L(n), and the Pisano period of 10 is 60:
+   //
+   BOOST_CHECK_EQUAL(fibonacci<I>(20000), I(fibonacci<I>(10000) * lucas<I>(10000)));
+   BOOST_CHECK_EQUAL(fibonacci(I(1) << 200, I(10)), fibonacci((I(1) << 200) % 60, I(10)));
+   BOOST_CHECK_EQUAL(fibonacci<boost::uint64_t>(93), 12200160415121876738uLL);
+   //
+   // Recurrences of higher order, with negative coefficients:
+   //
+   static const int coeffs[][4] = {{3, 0, 0, 0}, {0, 0, 1, 1}, {2, -1, 3, -7}, {1, 1, 1, 1}};
+   static const int inits[][4]  = {{5, 0, 0, 0}, {3, 0, 2, 0}, {1, -2, 0, 4}, {0, 0, 0, 1}};
+   static const unsigned orders[] = {1, 3, 4, 4};
+   for (unsigned k = 0; k < sizeof(orders) / sizeof(orders[0]); ++k)
+   {
+      std::vector<I> ck(coeffs[k], coeffs[k] + orders[k]), ik(inits[k], inits[k] + orders[k]);
+      std::vector<I> terms = naive_terms(ck, ik, 300);
+      for (unsigned n = 0; n < terms.size(); ++n)
+      {
+         BOOST_CHECK_EQUAL(linear_recurrence_nth(ck, ik, n), terms[n]);
+         for (unsigned m = 0; m < sizeof(moduli) / sizeof(moduli[0]); ++m)
+         {
+            I r = terms[n] % moduli[m];
+            if (r < 0)
+               r += moduli[m];
+            BOOST_CHECK_EQUAL(linear_recurrence_nth(ck, ik, n, moduli[m]), r);
+         }
+      }
+   }
+
+   BOOST_CHECK_THROW(fibonacci<I>(-1), std::domain_error);
+   BOOST_CHECK_THROW(lucas(-1, I(7)), std::domain_error);
+   BOOST_CHECK_THROW(fibonacci(3, I(0)), std::domain_error);
+   BOOST_CHECK_THROW(linear_recurrence_nth(std::vector<I>(), std::vector<I>(), 3), std::domain_error);
+   BOOST_CHECK_THROW(linear_recurrence_nth(c, std::vector<I>(3), 3), std::domain_error);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>();
+   test<number<cpp_int_backend<>, et_off> >();
+#ifdef TEST_GMP
+   test<mpz_int>();
+#endif
+
+   return boost::report_errors();
+}
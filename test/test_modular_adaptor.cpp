@@ -0,0 +1,208 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/modular_adaptor.hpp>
+#ifdef TEST_GMP
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+template <class T>
+T generate_random(unsigned max_limbs)
+{
+   static boost::random::mt19937                     gen;
+   boost::random::uniform_int_distribution<unsigned> ui(0, max_limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+//
+// Reduces a into [0, n):
+//
+template <class T>
+T reduce(const T& a, const T& n)
+{
+   T r = a % n;
+   return r < 0 ? T(r + n) : r;
+}
+
+template <class M, class T>
+void test_values(const T& a, const T& b, const T& n)
+{
+   typedef typename M::backend_type::params_type params_type;
+
+   //
+   // Values constructed from the same params share a context:
+   //
+   params_type p(n);
+   M           ma(p), mb(p);
+   ma = a;
+   mb = b;
+
+   BOOST_CHECK_EQUAL(residue(ma), reduce(a, n));
+   BOOST_CHECK_EQUAL(modulus(ma), n);
+   BOOST_CHECK_EQUAL(residue(M(ma + mb)), reduce(T(a + b), n));
+   BOOST_CHECK_EQUAL(residue(M(ma - mb)), reduce(T(a - b), n));
+   BOOST_CHECK_EQUAL(residue(M(mb - ma)), reduce(T(b - a), n));
+   BOOST_CHECK_EQUAL(residue(M(ma * mb)), reduce(T(a * b), n));
+   BOOST_CHECK_EQUAL(residue(M(ma * ma)), reduce(T(a * a), n));
+   BOOST_CHECK_EQUAL(residue(M(-ma)), reduce(T(-a), n));
+   BOOST_CHECK_EQUAL(residue(M(ma * mb + ma * 3 - 2)), reduce(T(a * b + a * 3 - 2), n));
+   BOOST_CHECK_EQUAL(ma == mb, reduce(a, n) == reduce(b, n));
+   BOOST_CHECK(ma == M(ma + n.backend()) || n == 1);
+   //
+   // Values with the same modulus but a different context:
+   //
+   M mc(b, n);
+   BOOST_CHECK_EQUAL(residue(M(ma * mc)), reduce(T(a * b), n));
+   BOOST_CHECK(mb == mc);
+   //
+   // Assignment keeps the modulus:
+   //
+   M md(ma);
+   md = 7;
+   BOOST_CHECK_EQUAL(residue(md), reduce(T(7), n));
+   BOOST_CHECK_EQUAL(modulus(md), n);
+   md *= ma;
+   md += 2;
+   BOOST_CHECK_EQUAL(residue(md), reduce(T(a * 7 + 2), n));
+   //
+   // Powers and inverses:
+   //
+   unsigned e = static_cast<unsigned>(b & 0xFFFFu);
+   BOOST_CHECK_EQUAL(residue(M(pow(ma, e))), T(powm(reduce(a, n), e, n)));
+   T eb = abs(b);
+   BOOST_CHECK_EQUAL(residue(pow(ma, eb)), T(powm(reduce(a, n), eb, n)));
+   if (gcd(reduce(a, n), n) == 1)
+   {
+      M inv = inverse(ma);
+      BOOST_CHECK_EQUAL(residue(M(inv * ma)), reduce(T(1), n));
+      BOOST_CHECK_EQUAL(residue(M(mb / ma)), reduce(T(b * residue(inv)), n));
+      BOOST_CHECK_EQUAL(residue(M(pow(inv, 3))), reduce(T(residue(inv) * residue(inv) * residue(inv)), n));
+   }
+   else
+   {
+      BOOST_CHECK_THROW(M(mb / ma), std::domain_error);
+      BOOST_CHECK_THROW(inverse(ma), std::domain_error);
+   }
+   //
+   // Conversions:
+   //
+   BOOST_CHECK_EQUAL(ma.str(), residue(ma).str());
+   BOOST_CHECK_EQUAL(static_cast<unsigned>(ma), static_cast<unsigned>(reduce(a, n)));
+}
+
+template <class M, class T>
+void test(unsigned max_limbs)
+{
+   for (unsigned i = 0; i < 50; ++i)
+   {
+      T n = generate_random<T>(max_limbs);
+      if (n == 0)
+         n = 1;
+      test_values<M>(generate_random<T>(max_limbs), generate_random<T>(max_limbs), T(n | 1));
+      test_values<M>(generate_random<T>(max_limbs), generate_random<T>(max_limbs), T(n & ~T(1)) == 0 ? T(2) : T(n & ~T(1)));
+      test_values<M>(generate_random<T>(2 * max_limbs), generate_random<T>(max_limbs), T(n | 1));
+      test_values<M>(T(-generate_random<T>(2 * max_limbs)), generate_random<T>(max_limbs), T(n | 1));
+   }
+   //
+   // Special cases:
+   //
+   test_values<M>(T(0), T(0), T(1));
+   test_values<M>(T(5), T(3), T(1));
+   test_values<M>(T(0), T(3), T(7));
+   T n(1);
+   n <<= 32 * max_limbs + 31;
+   test_values<M>(T(n - 1), T(n - 2), T(n - 1));
+   test_values<M>(T(n - 1), T(n + 2), n);
+   //
+   // Construction from components, and errors:
+   //
+   M m(T(12), T(5));
+   BOOST_CHECK_EQUAL(residue(m), 2);
+   BOOST_CHECK_EQUAL(modulus(m), 5);
+   BOOST_CHECK_EQUAL(residue(M(m + 1)), 3);
+   BOOST_CHECK_EQUAL(residue(M(2 * m)), 4);
+   BOOST_CHECK_THROW(M(T(1), T(0)), std::domain_error);
+   BOOST_CHECK_THROW(M(T(1), T(-5)), std::domain_error);
+   BOOST_CHECK_THROW(M(m + M(T(1), T(7))), std::domain_error);
+   //
+   // Values with no modulus behave as plain integers:
+   //
+   M a(T(7).backend()), b(T(3).backend());
+   BOOST_CHECK_EQUAL(residue(M(a * b - 1)), 20);
+}
+
+//
+// A modulus which uses every bit of a fixed precision type, so that sums of residues
+// overflow unless the context avoids forming them:
+//
+template <class M, class T>
+void test_full_width()
+{
+   using boost::multiprecision::cpp_int;
+
+   T       n = (std::numeric_limits<T>::max)() - 188;
+   cpp_int cn(n);
+   T       values[] = {T(0), T(1), T(2), T(n >> 1), T((n >> 1) + 1), T(n - 2), T(n - 1), T(n - 12345)};
+   for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+   {
+      for (unsigned j = 0; j < sizeof(values) / sizeof(values[0]); ++j)
+      {
+         M       a(values[i], n), b(values[j], n);
+         cpp_int x(values[i]), y(values[j]);
+         BOOST_CHECK_EQUAL(cpp_int(residue(M(a + b))), cpp_int((x + y) % cn));
+         BOOST_CHECK_EQUAL(cpp_int(residue(M(a - b))), cpp_int((x + cn - y) % cn));
+         BOOST_CHECK_EQUAL(cpp_int(residue(M(a * b))), cpp_int((x * y) % cn));
+         BOOST_CHECK_EQUAL(cpp_int(residue(M(-a))), cpp_int((cn - x) % cn));
+         M c(a);
+         c += b;
+         c -= a;
+         BOOST_CHECK(c == b);
+      }
+   }
+   M a(T(n - 1), n);
+   BOOST_CHECK_EQUAL(cpp_int(residue(M(pow(a, 3)))), cn - 1);
+   BOOST_CHECK_EQUAL(cpp_int(residue(M(inverse(a)))), cn - 1);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<number<modular_adaptor<cpp_int_backend<> > >, cpp_int>(1);
+   test<number<modular_adaptor<cpp_int_backend<> > >, cpp_int>(8);
+   test<number<modular_adaptor<cpp_int_backend<> > >, cpp_int>(40);
+   test<number<modular_adaptor<cpp_int_backend<> >, et_off>, number<cpp_int_backend<>, et_off> >(4);
+   test<number<modular_adaptor<int1024_t::backend_type> >, int1024_t>(6);
+   test_full_width<number<modular_adaptor<uint256_t::backend_type> >, uint256_t>();
+   test_full_width<number<modular_adaptor<uint1024_t::backend_type> >, uint1024_t>();
+#ifdef TEST_GMP
+   test<number<modular_adaptor<gmp_int> >, mpz_int>(8);
+#endif
+   return boost::report_errors();
+}
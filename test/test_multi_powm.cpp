@@ -0,0 +1,128 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/multi_powm.hpp>
+#ifdef TEST_GMP
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+template <class T>
+T generate_random(unsigned max_limbs)
+{
+   static boost::random::mt19937                     gen;
+   boost::random::uniform_int_distribution<unsigned> ui(0, max_limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+template <class T>
+T reduce(const T& a, const T& n)
+{
+   T r = a % n;
+   return r < 0 ? T(r + n) : r;
+}
+
+//
+// The product of separate powm calls:
+//
+template <class T>
+T reference_multi_powm(const std::vector<T>& bases, const std::vector<T>& exponents, const T& m)
+{
+   T result = reduce(T(1), m);
+   for (std::size_t i = 0; i < bases.size(); ++i)
+      result = T(result * T(powm(reduce(bases[i], m), exponents[i], m))) % m;
+   return result;
+}
+
+template <class T>
+void test_values(std::size_t k, unsigned base_limbs, unsigned exponent_limbs, const T& m)
+{
+   std::vector<T> bases, exponents;
+   for (std::size_t i = 0; i < k; ++i)
+   {
+      bases.push_back(generate_random<T>(base_limbs));
+      exponents.push_back(generate_random<T>(exponent_limbs));
+   }
+   if (k > 2)
+   {
+      exponents[1] = 0;
+      bases[2]     = 0;
+   }
+   BOOST_CHECK_EQUAL(multi_powm(bases, exponents, m), reference_multi_powm(bases, exponents, m));
+}
+
+template <class T>
+void test(unsigned max_limbs)
+{
+   static const std::size_t sizes[] = {0, 1, 2, 3, 5, 16, 60, 200};
+   for (unsigned i = 0; i < 5; ++i)
+   {
+      T m = generate_random<T>(max_limbs);
+      if (m < 2)
+         m = 2;
+      for (unsigned j = 0; j < sizeof(sizes) / sizeof(sizes[0]); ++j)
+      {
+         test_values(sizes[j], max_limbs, max_limbs, T(m | 1));
+         test_values(sizes[j], max_limbs, max_limbs, T(m & ~T(1)) == 0 ? T(2) : T(m & ~T(1)));
+         test_values(sizes[j], 2 * max_limbs, 1, T(m | 1));
+      }
+   }
+   //
+   // Special cases:
+   //
+   std::vector<T> bases, exponents;
+   BOOST_CHECK_EQUAL(multi_powm(bases, exponents, T(7)), 1);
+   BOOST_CHECK_EQUAL(multi_powm(bases, exponents, T(1)), 0);
+   bases.push_back(T(3));
+   bases.push_back(T(-2));
+   exponents.push_back(T(0));
+   exponents.push_back(T(0));
+   BOOST_CHECK_EQUAL(multi_powm(bases, exponents, T(7)), 1);
+   exponents[1] = 3;
+   BOOST_CHECK_EQUAL(multi_powm(bases, exponents, T(7)), 6);
+   BOOST_CHECK_EQUAL(multi_powm(bases.begin() + 1, bases.end(), exponents.begin() + 1, T(7)), 6);
+   exponents[0] = -1;
+   BOOST_CHECK_THROW(multi_powm(bases, exponents, T(7)), std::runtime_error);
+   exponents.pop_back();
+   BOOST_CHECK_THROW(multi_powm(bases, exponents, T(7)), std::domain_error);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(1);
+   test<cpp_int>(8);
+   test<cpp_int>(32);
+   test<number<cpp_int_backend<>, et_off> >(4);
+   test<int1024_t>(14);
+#ifdef TEST_GMP
+   test<mpz_int>(8);
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/parallel_miller_rabin.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+template <class I>
+void test(unsigned count)
+{
+   using namespace boost::random;
+   using namespace boost::multiprecision;
+
+   typedef I test_type;
+
+   static const unsigned test_bits =
+       std::numeric_limits<test_type>::digits && (std::numeric_limits<test_type>::digits <= 256)
+           ? std::numeric_limits<test_type>::digits
+           : 256;
+
+   independent_bits_engine<mt11213b, test_bits, test_type> gen;
+
+   static const unsigned threads[] = {1, 2, 3, 8, 0};
+
+   for (unsigned i = 1; i < boost::math::max_prime; i += 37)
+   {
+      mt19937 gen2;
+      BOOST_TEST(parallel_miller_rabin_test(test_type(boost::math::prime(i)), 25, gen2, 4));
+      BOOST_TEST(!parallel_miller_rabin_test(test_type(boost::math::prime(i) + 1), 25, gen2, 4));
+   }
+   //
+   // Random values and products of two primes: the result, and the state of the engine
+   // afterwards, must not depend on the number of threads:
+   //
+   for (unsigned i = 0; i < count; ++i)
+   {
+      test_type n = gen();
+      if (i & 1)
+      {
+         test_type a = gen() >> (test_bits / 2), b = gen() >> (test_bits / 2);
+         n           = (a | 1) * (b | 1);
+      }
+      n |= 1;
+      mt19937 gen2(i), gen3(i);
+      bool    expected = miller_rabin_test(n, 25, gen2);
+      gen2.seed(i);
+      parallel_miller_rabin_test(n, 25, gen2, 1);
+      for (unsigned j = 0; j < sizeof(threads) / sizeof(threads[0]); ++j)
+      {
+         gen3.seed(i);
+         BOOST_CHECK_EQUAL(parallel_miller_rabin_test(n, 25, gen3, threads[j]), expected);
+         BOOST_CHECK(gen2 == gen3);
+      }
+   }
+   //
+   // Searching a range of candidates gives the same result as testing each in turn:
+   //
+   for (unsigned i = 0; i < count / 10; ++i)
+   {
+      std::vector<test_type> candidates;
+      test_type              n = gen();
+      n |= 1;
+      for (unsigned j = 0; j < 200; ++j, n += 2)
+         candidates.push_back(n);
+      //
+      // Test each candidate with a copy of the engine, then move on by the trials witnesses
+      // which are drawn for every odd candidate:
+      //
+      mt19937 gen2(i);
+      int     expected = -1;
+      for (unsigned j = 0; j < candidates.size(); ++j)
+      {
+         mt19937 gen4(gen2);
+         if ((expected < 0) && miller_rabin_test(candidates[j], 25, gen4))
+            expected = j;
+         boost::random::uniform_int_distribution<test_type> dist(2, candidates[j] - 2);
+         for (unsigned k = 0; k < 25; ++k)
+            dist(gen2);
+      }
+      for (unsigned j = 0; j < sizeof(threads) / sizeof(threads[0]); ++j)
+      {
+         mt19937 gen3(i);
+         typename std::vector<test_type>::iterator pos = parallel_find_probable_prime(candidates.begin(), candidates.end(), 25, gen3, threads[j]);
+         BOOST_CHECK_EQUAL(pos - candidates.begin(), expected < 0 ? 200 : expected);
+         BOOST_CHECK(gen2 == gen3);
+      }
+   }
+   //
+   // No probable primes, and small values:
+   //
+   std::vector<test_type> evens(50, test_type(1000));
+   mt19937                gen2;
+   BOOST_CHECK(parallel_find_probable_prime(evens.begin(), evens.end(), 25, gen2) == evens.end());
+   static const unsigned small[] = {0, 1, 4, 9, 15, 2, 3};
+   BOOST_CHECK_EQUAL(parallel_find_probable_prime(small, small + 7, 25, gen2, 3) - small, 5);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(200);
+   test<number<cpp_int_backend<>, et_off> >(50);
+   test<uint1024_t>(100);
+   test<checked_uint1024_t>(50);
+   test<boost::uint64_t>(500);
+
+   return boost::report_errors();
+}
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 The Boost.Multiprecision contributors. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+//
+// Use a small window so that the searches below cross many window boundaries:
+//
+#define BOOST_MP_PRIME_SIEVE_WINDOW 64
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/prime_generation.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+template <class I>
+bool gmp_is_prime(const I& n)
+{
+   return mpz_probab_prime_p(boost::multiprecision::mpz_int(n).backend().data(), 25) ? true : false;
+}
+
+template <class I>
+void test_next_prime(const I& n)
+{
+   using namespace boost::multiprecision;
+   I p = next_prime(n);
+   BOOST_CHECK_GT(p, n);
+   BOOST_CHECK(gmp_is_prime(p));
+   mpz_int q;
+   mpz_nextprime(q.backend().data(), mpz_int(n).backend().data());
+   BOOST_CHECK_EQUAL(mpz_int(p), q);
+}
+
+template <class I>
+void test(unsigned max_bits)
+{
+   using namespace boost::multiprecision;
+   using namespace boost::random;
+
+   //
+   // Small values, including those below the sieve's lower limit and either side of it:
+   //
+   BOOST_CHECK_EQUAL(next_prime(I(0)), 2);
+   BOOST_CHECK_EQUAL(next_prime(I(1)), 2);
+   BOOST_CHECK_EQUAL(next_prime(I(2)), 3);
+   BOOST_CHECK_EQUAL(next_prime(I(3)), 5);
+   for (unsigned i = 4; i < 50000; i += 37)
+      test_next_prime(I(i));
+   //
+   // Random values:
+   //
+   independent_bits_engine<mt11213b, 32, I> gen;
+   mt19937                                  gen2;
+   for (unsigned bits = 32; bits <= max_bits; bits *= 2)
+   {
+      for (unsigned i = 0; i < 20; ++i)
+      {
+         I n(gen());
+         for (unsigned j = 32; j < bits; j += 32)
+         {
+            n <<= 32;
+            n |= gen();
+         }
+         test_next_prime(n);
+      }
+   }
+   //
+   // Random primes of each size:
+   //
+   for (unsigned bits = 2; bits <= max_bits; bits += bits < 70 ? 1 : 67)
+   {
+      I p = random_prime<I>(bits, gen2);
+      BOOST_CHECK_EQUAL(msb(p), bits - 1);
+      BOOST_CHECK(gmp_is_prime(p));
+   }
+   for (unsigned bits = 3; bits <= (std::min)(max_bits, 256u); bits += bits < 70 ? 1 : 67)
+   {
+      I p = random_safe_prime<I>(bits, gen2);
+      BOOST_CHECK_EQUAL(msb(p), bits - 1);
+      BOOST_CHECK(gmp_is_prime(p));
+      BOOST_CHECK(gmp_is_prime(I(p >> 1)));
+   }
+   BOOST_CHECK_THROW(random_prime<I>(1, gen2), std::domain_error);
+   BOOST_CHECK_THROW(random_safe_prime<I>(2, gen2), std::domain_error);
+   //
+   // Searches bounded by a maximum which falls exactly at the end of a sieve window: there is no
+   // prime between 2010733 and 2010881, and 2010735 + 2 * 63 is the last candidate in the window:
+   //
+   I result;
+   I max(2010861u);
+   BOOST_CHECK(!boost::multiprecision::detail::prime_search(result, I(2010735u), &max, 2, false));
+   max = 2010881u;
+   BOOST_CHECK(boost::multiprecision::detail::prime_search(result, I(2010755u), &max, 2, false));
+   BOOST_CHECK_EQUAL(result, 2010881u);
+   max = 2010879u;
+   BOOST_CHECK(!boost::multiprecision::detail::prime_search(result, I(2010753u), &max, 2, false));
+   //
+   // Expression templates:
+   //
+   I a(1000), b(3);
+   BOOST_CHECK_EQUAL(next_prime(a * b), 3001);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(1024);
+   test<number<cpp_int_backend<>, et_off> >(256);
+   test<mpz_int>(1024);
+   test<uint512_t>(512);
+   test<checked_uint1024_t>(1024);
+   test<boost::uint64_t>(64);
+   //
+   // Close to the top of a fixed precision range:
+   //
+   BOOST_CHECK_EQUAL(next_prime(boost::uint32_t(4294967280u)), 4294967291u);
+   BOOST_CHECK_THROW(next_prime(boost::uint32_t(4294967291u)), std::overflow_error);
+   BOOST_CHECK_EQUAL(next_prime(boost::uint64_t(18446744073709551000uLL)), 18446744073709551113uLL);
+   BOOST_CHECK_EQUAL(next_prime(boost::uint64_t(18446744073709551533uLL)), 18446744073709551557uLL);
+   BOOST_CHECK_THROW(next_prime(boost::uint64_t(18446744073709551557uLL)), std::overflow_error);
+   BOOST_CHECK_THROW(next_prime((std::numeric_limits<boost::uint64_t>::max)()), std::overflow_error);
+   uint128_t m = (std::numeric_limits<uint128_t>::max)();
+   BOOST_CHECK_EQUAL(next_prime(uint128_t(m - 200)), m - 172);
+   BOOST_CHECK_EQUAL(next_prime(uint128_t(m - 172)), m - 158);
+   BOOST_CHECK_THROW(next_prime(uint128_t(m - 158)), std::overflow_error);
+
+   return boost::report_errors();
+}
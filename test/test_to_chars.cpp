@@ -0,0 +1,304 @@
+// Copyright 2026 The Boost.Multiprecision contributors.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#if !defined(TEST_CPP_INT) && !defined(TEST_CPP_BIN_FLOAT) && !defined(TEST_CPP_DEC_FLOAT) && !defined(TEST_MPZ)
+#define TEST_CPP_INT
+#define TEST_CPP_BIN_FLOAT
+#define TEST_CPP_DEC_FLOAT
+#define TEST_MPZ
+
+#ifdef _MSC_VER
+#pragma message("CAUTION!!: No backend type specified so testing everything.... this will take some time!!")
+#endif
+#ifdef __GNUC__
+#pragma warning "CAUTION!!: No backend type specified so testing everything.... this will take some time!!"
+#endif
+
+#endif
+
+#if defined(TEST_CPP_INT)
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+#if defined(TEST_CPP_BIN_FLOAT)
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#endif
+#if defined(TEST_CPP_DEC_FLOAT)
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#endif
+#if defined(TEST_MPZ)
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "test.hpp"
+#include <iostream>
+#include <iomanip>
+
+#ifdef BOOST_MSVC
+#pragma warning(disable : 4127)
+#endif
+
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+
+static boost::random::mt19937 gen;
+
+template <class T>
+void check_to_chars(const T& val, std::ios_base::fmtflags f, std::streamsize digits, bool check_max_chars)
+{
+   using boost::multiprecision::max_chars;
+   std::string expected = val.str(digits, f);
+   std::string buf(expected.size() + 20, 'z');
+
+   boost::multiprecision::to_chars_result r = boost::multiprecision::to_chars(&buf[0], &buf[0] + buf.size(), val, f, digits);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(std::string(&buf[0], r.ptr), expected);
+   //
+   // An exactly sized buffer works, one that is one short does not:
+   //
+   r = boost::multiprecision::to_chars(&buf[0], &buf[0] + expected.size(), val, f, digits);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == &buf[0] + expected.size());
+   r = boost::multiprecision::to_chars(&buf[0], &buf[0] + expected.size() - 1, val, f, digits);
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+   BOOST_CHECK(r.ptr == &buf[0] + expected.size() - 1);
+
+   if (check_max_chars && max_chars<T>::value)
+   {
+      BOOST_CHECK_LE(expected.size(), max_chars<T>::value);
+   }
+}
+
+template <class T>
+void check_from_chars(const T& val, const std::string& s, std::size_t len)
+{
+   //
+   // Parsing stops at the first character that can't be part of the number:
+   //
+   std::string                              input = s + "#12";
+   T                                        parsed;
+   boost::multiprecision::from_chars_result r = boost::multiprecision::from_chars(input.data(), input.data() + input.size(), parsed);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == input.data() + len);
+   BOOST_CHECK_EQUAL(parsed, val);
+}
+template <class T>
+void check_from_chars(const T& val, const std::string& s)
+{
+   check_from_chars(val, s, s.size());
+}
+
+template <class T>
+T generate_random_int()
+{
+   static const unsigned limbs = std::numeric_limits<T>::is_specialized && std::numeric_limits<T>::is_bounded ? std::numeric_limits<T>::digits / std::numeric_limits<unsigned>::digits - 1 : 30;
+
+   boost::random::uniform_int_distribution<unsigned> ui(0, limbs);
+   T                                                 val = gen();
+   unsigned                                          lim = ui(gen);
+   for (unsigned i = 0; i < lim; ++i)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+template <class T>
+void test_negative(const T&, const boost::mpl::false_&)
+{
+}
+template <class T>
+void test_negative(const T& val, const boost::mpl::true_&)
+{
+   if (!val)
+      return;
+   T neg = -val;
+   check_to_chars(neg, std::ios_base::fmtflags(0), 0, true);
+   check_from_chars(neg, neg.str());
+   //
+   // Negative values can not be printed in hex or octal:
+   //
+   char                                   buf[10];
+   boost::multiprecision::to_chars_result r = boost::multiprecision::to_chars(buf, buf + sizeof(buf), neg, std::ios_base::hex);
+   BOOST_CHECK(r.ec == std::errc::invalid_argument);
+}
+
+template <class T>
+void test_integer()
+{
+   using boost::multiprecision::max_chars;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      T val = generate_random_int<T>();
+      if (i == 0)
+         val = 0;
+      check_to_chars(val, std::ios_base::fmtflags(0), 0, true);
+      check_to_chars(val, std::ios_base::showpos, 0, true);
+      check_to_chars(val, std::ios_base::hex, 0, true);
+      check_to_chars(val, std::ios_base::hex | std::ios_base::showbase | std::ios_base::uppercase, 0, true);
+      check_to_chars(val, std::ios_base::oct | std::ios_base::showbase, 0, true);
+      check_from_chars(val, val.str());
+      check_from_chars(val, val.str(0, std::ios_base::hex | std::ios_base::showbase));
+      check_from_chars(val, val.str(0, std::ios_base::oct | std::ios_base::showbase));
+      test_negative(val, boost::mpl::bool_<std::numeric_limits<T>::is_signed>());
+      if (max_chars<T>::value)
+      {
+         //
+         // A buffer of max_chars is always enough:
+         //
+         char                                   buf[max_chars<T>::value ? max_chars<T>::value : 1];
+         boost::multiprecision::to_chars_result r = boost::multiprecision::to_chars(buf, buf + sizeof(buf), val, std::ios_base::oct | std::ios_base::showbase);
+         BOOST_CHECK(r.ec == std::errc());
+      }
+   }
+   //
+   // Invalid input leaves the value unchanged:
+   //
+   const char* bad[] = {"", "-", "x12", "+12", " 12", "-x"};
+   for (unsigned i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i)
+   {
+      T                                        val(2);
+      boost::multiprecision::from_chars_result r = boost::multiprecision::from_chars(bad[i], bad[i] + std::strlen(bad[i]), val);
+      BOOST_CHECK(r.ec == std::errc::invalid_argument);
+      BOOST_CHECK(r.ptr == bad[i]);
+      BOOST_CHECK_EQUAL(val, 2);
+   }
+   //
+   // Partial matches:
+   //
+   const char* partial[] = {"12a", "0x1fg", "0779", "0x", "-5e2", "123 456"};
+   const int   values[]  = {12, 31, 63, 0, -5, 123};
+   const int   lengths[] = {2, 4, 3, 1, 2, 3};
+   for (unsigned i = 0; i < sizeof(partial) / sizeof(partial[0]); ++i)
+   {
+      if (!std::numeric_limits<T>::is_signed && (values[i] < 0))
+         continue;
+      T                                        val;
+      boost::multiprecision::from_chars_result r = boost::multiprecision::from_chars(partial[i], partial[i] + std::strlen(partial[i]), val);
+      BOOST_CHECK(r.ec == std::errc());
+      BOOST_CHECK(r.ptr == partial[i] + lengths[i]);
+      BOOST_CHECK_EQUAL(val, values[i]);
+   }
+}
+
+template <class T>
+void test_out_of_range()
+{
+#ifndef BOOST_NO_EXCEPTIONS
+   std::string                              s = T((std::numeric_limits<T>::max)()).str() + "0";
+   T                                        val(2);
+   boost::multiprecision::from_chars_result r = boost::multiprecision::from_chars(s.data(), s.data() + s.size(), val);
+   BOOST_CHECK(r.ec == std::errc::result_out_of_range);
+   BOOST_CHECK(r.ptr == s.data() + s.size());
+   BOOST_CHECK_EQUAL(val, 2);
+#endif
+}
+
+template <class T>
+T generate_random_float()
+{
+   T val = T(gen()) / T(gen() | 1);
+   int e = static_cast<int>(gen() % 200) - 100;
+   switch (gen() % 8)
+   {
+   case 0:
+      return T(0);
+   case 1:
+      return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : val;
+   case 2:
+      return std::numeric_limits<T>::has_quiet_NaN ? std::numeric_limits<T>::quiet_NaN() : val;
+   case 3:
+      return T(gen() % 1000) / 8;
+   case 4:
+      return ldexp(val, static_cast<int>(gen() % 2000) - 1000);
+   default:
+      return ldexp(val, e);
+   }
+}
+
+template <class T>
+void test_float()
+{
+   const std::ios_base::fmtflags flags[] = {std::ios_base::fmtflags(0), std::ios_base::fixed, std::ios_base::scientific, std::ios_base::showpoint, std::ios_base::showpos};
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      T val = generate_random_float<T>();
+      if (gen() % 2)
+         val = -val;
+      std::ios_base::fmtflags f = std::ios_base::fmtflags(0);
+      for (unsigned j = 0; j < sizeof(flags) / sizeof(flags[0]); ++j)
+      {
+         if (gen() % 3 == 0)
+            f |= flags[j];
+      }
+      if ((f & std::ios_base::fixed) && (f & std::ios_base::scientific) && (gen() % 2))
+         f &= ~std::ios_base::fixed;
+      std::streamsize digits = gen() % 4 ? 0 : gen() % 40;
+      check_to_chars(val, f, digits, (digits == 0) && !(f & std::ios_base::fixed));
+      //
+      // Round trip at full precision:
+      //
+      if ((boost::math::isfinite)(val))
+         check_from_chars(val, val.str(0, std::ios_base::scientific));
+   }
+   check_from_chars(T(1.5), "1.5");
+   check_from_chars(T(-0.25), "-.25");
+   check_from_chars(T(1500), "1.5e3");
+   check_from_chars(T(-150), "-1.5E+2");
+   check_from_chars(T(1.5), "1.5e", 3);
+   check_from_chars(T(2), "2.e-x", 2);
+   if (std::numeric_limits<T>::has_infinity)
+   {
+      check_from_chars(std::numeric_limits<T>::infinity(), "inf");
+      check_from_chars(T(-std::numeric_limits<T>::infinity()), "-infinity");
+   }
+   const char* bad[] = {"", "-", ".", "e5", "-.e5", "+1"};
+   for (unsigned i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i)
+   {
+      T                                        val(2);
+      boost::multiprecision::from_chars_result r = boost::multiprecision::from_chars(bad[i], bad[i] + std::strlen(bad[i]), val);
+      BOOST_CHECK(r.ec == std::errc::invalid_argument);
+      BOOST_CHECK(r.ptr == bad[i]);
+      BOOST_CHECK_EQUAL(val, 2);
+   }
+}
+
+#endif
+
+int main()
+{
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+   using namespace boost::multiprecision;
+#ifdef TEST_CPP_INT
+   test_integer<cpp_int>();
+   test_integer<int128_t>();
+   test_integer<uint512_t>();
+   test_integer<checked_int1024_t>();
+   test_integer<number<cpp_int_backend<70, 70, unsigned_magnitude, unchecked, void> > >();
+   test_out_of_range<checked_int1024_t>();
+   test_out_of_range<checked_uint128_t>();
+#endif
+#ifdef TEST_MPZ
+   test_integer<mpz_int>();
+#endif
+#ifdef TEST_CPP_BIN_FLOAT
+   test_float<cpp_bin_float_50>();
+   test_float<cpp_bin_float_double>();
+   test_float<cpp_bin_float_quad>();
+#endif
+#ifdef TEST_CPP_DEC_FLOAT
+   test_float<cpp_dec_float_50>();
+   test_float<number<cpp_dec_float<17> > >();
+#endif
+#endif
+   return boost::report_errors();
+}